@@ -1606,6 +1606,8 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "display/window/size/window_height_override", PROPERTY_HINT_RANGE, "0,4320,1,or_greater"), 0); // 8K resolution
 
 	GLOBAL_DEF("display/window/energy_saving/keep_screen_on", true);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "animation/mixer/lod_distance_scale", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"), 1.0);
+	GLOBAL_DEF("animation/mixer/parallel_blending", false);
 	GLOBAL_DEF("animation/warnings/check_invalid_track_paths", true);
 	GLOBAL_DEF("animation/warnings/check_angle_interpolation_type_conflicting", true);
 
@@ -1725,6 +1727,7 @@ ProjectSettings::ProjectSettings() {
 
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_multiple_threads", true);
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_high_priority_threads", true);
+	GLOBAL_DEF("navigation/avoidance/neighbor_search/use_uniform_grid", false);
 
 	GLOBAL_DEF("navigation/pathfinding/max_threads", 4);
 
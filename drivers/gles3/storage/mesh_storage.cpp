@@ -2299,6 +2299,20 @@ void MeshStorage::skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_
 	skeleton->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_SKELETON_DATA);
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * (skeleton->use_2d ? 8 : 12));
+	if (p_buffer.is_empty()) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -600,6 +600,7 @@ public:
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) override;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const override;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) override;
 
 	virtual void skeleton_update_dependency(RID p_base, DependencyTracker *p_instance) override;
 
@@ -32,6 +32,7 @@
 
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "scene/animation/animation_mixer.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
 #include "servers/audio_server.h"
@@ -128,7 +129,9 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_AVOIDANCE_TIME);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(ANIMATION_SKIPPED_UPDATES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -208,7 +211,9 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_connected"),
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
+		PNAME("navigation_3d/avoidance_time"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("animation/skipped_updates"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -431,7 +436,11 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_3D_AVOIDANCE_TIME:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_AVOIDANCE_TIME) / 1000000.0;
 #endif // NAVIGATION_3D_DISABLED
+		case ANIMATION_SKIPPED_UPDATES:
+			return AnimationMixer::get_lod_skipped_update_count();
 
 		default: {
 		}
@@ -503,6 +512,8 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
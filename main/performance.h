@@ -125,6 +125,8 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		NAVIGATION_3D_AVOIDANCE_TIME,
+		ANIMATION_SKIPPED_UPDATES,
 		MONITOR_MAX
 	};
 
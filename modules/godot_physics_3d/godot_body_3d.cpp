@@ -799,6 +799,47 @@ bool GodotBody3D::sleep_test(real_t p_step) {
 	}
 }
 
+void GodotBody3D::get_snapshot_state(SnapshotState &r_state) const {
+	r_state.rid = get_self().get_id();
+	r_state.transform = get_transform();
+	r_state.new_transform = new_transform;
+	r_state.linear_velocity = linear_velocity;
+	r_state.angular_velocity = angular_velocity;
+	r_state.prev_linear_velocity = prev_linear_velocity;
+	r_state.prev_angular_velocity = prev_angular_velocity;
+	r_state.applied_force = applied_force;
+	r_state.applied_torque = applied_torque;
+	r_state.constant_force = constant_force;
+	r_state.constant_torque = constant_torque;
+	r_state.still_time = still_time;
+	r_state.active = active ? 1 : 0;
+}
+
+void GodotBody3D::set_snapshot_state(const SnapshotState &p_state) {
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
+	prev_linear_velocity = p_state.prev_linear_velocity;
+	prev_angular_velocity = p_state.prev_angular_velocity;
+	applied_force = p_state.applied_force;
+	applied_torque = p_state.applied_torque;
+	constant_force = p_state.constant_force;
+	constant_torque = p_state.constant_torque;
+	new_transform = p_state.new_transform;
+
+	if (get_transform() != p_state.transform) {
+		_set_transform(p_state.transform);
+		if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+			_set_inv_transform(get_transform().inverse());
+			_update_transform_dependent();
+		} else {
+			_set_inv_transform(get_transform().affine_inverse());
+		}
+	}
+
+	still_time = p_state.still_time;
+	set_active(p_state.active != 0);
+}
+
 void GodotBody3D::set_state_sync_callback(const Callable &p_callable) {
 	body_state_callback = p_callable;
 }
@@ -150,6 +150,29 @@ class GodotBody3D : public GodotCollisionObject3D {
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
+	// Simulation state captured by space snapshots, kept as plain data so it can be copied in bulk.
+	struct SnapshotState {
+		uint64_t rid = 0;
+		Transform3D transform;
+		Transform3D new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 prev_linear_velocity;
+		Vector3 prev_angular_velocity;
+		Vector3 applied_force;
+		Vector3 applied_torque;
+		Vector3 constant_force;
+		Vector3 constant_torque;
+		real_t still_time = 0.0;
+		uint32_t active = 0;
+	};
+
+	void get_snapshot_state(SnapshotState &r_state) const;
+	void set_snapshot_state(const SnapshotState &p_state);
+
+	// Moves the shapes without touching the simulation state, used while resolving batched motion tests.
+	_FORCE_INLINE_ void set_motion_test_transform(const Transform3D &p_transform) { _set_transform(p_transform); }
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
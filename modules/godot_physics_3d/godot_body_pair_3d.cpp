@@ -250,6 +250,34 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	return true;
 }
 
+static _FORCE_INLINE_ real_t _shape_motion_bound(const GodotShape3D *p_shape, const Transform3D &p_from, const Transform3D &p_to) {
+	// Upper bound of how far any point of the shape moves between both transforms.
+	const AABB &aabb = p_shape->get_aabb();
+	const Vector3 end = aabb.get_end();
+	const real_t extent = Vector3(MAX(Math::abs(aabb.position.x), Math::abs(end.x)), MAX(Math::abs(aabb.position.y), Math::abs(end.y)), MAX(Math::abs(aabb.position.z), Math::abs(end.z))).length();
+
+	real_t basis_delta_squared = 0.0;
+	for (int i = 0; i < 3; i++) {
+		basis_delta_squared += (p_to.basis.rows[i] - p_from.basis.rows[i]).length_squared();
+	}
+
+	return p_to.origin.distance_to(p_from.origin) + Math::sqrt(basis_delta_squared) * extent;
+}
+
+bool GodotBodyPair3D::_is_manifold_cache_valid(const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B) const {
+	if (!manifold_cache.valid) {
+		return false;
+	}
+
+	if (manifold_cache.shape_A != p_shape_A || manifold_cache.shape_B != p_shape_B || manifold_cache.version_A != p_shape_A->get_version() || manifold_cache.version_B != p_shape_B->get_version()) {
+		return false;
+	}
+
+	// Both transforms are relative to the origin of A, so the cache also holds while both bodies move together.
+	real_t motion = _shape_motion_bound(p_shape_A, manifold_cache.xform_A, p_xform_A) + _shape_motion_bound(p_shape_B, manifold_cache.xform_B, p_xform_B);
+	return motion < space->get_contact_recycle_radius();
+}
+
 real_t combine_bounce(GodotBody3D *A, GodotBody3D *B) {
 	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
 }
@@ -263,6 +291,7 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
 		collided = false;
+		manifold_cache.valid = false;
 		return false;
 	}
 
@@ -275,14 +304,13 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 			report_contacts_only = true;
 		} else {
 			collided = false;
+			manifold_cache.valid = false;
 			return false;
 		}
 	}
 
 	offset_B = B->get_transform().get_origin() - A->get_transform().get_origin();
 
-	validate_contacts();
-
 	const Vector3 &offset_A = A->get_transform().get_origin();
 	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
 	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
@@ -294,7 +322,31 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
 	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	bool cache_hit = _is_manifold_cache_valid(shape_A_ptr, xform_A, shape_B_ptr, xform_B);
+
+	validate_contacts();
+
+	if (cache_hit) {
+		// Neither shape moved enough to change the narrowphase result, so the surviving contacts
+		// are kept along with their accumulated impulses for warm starting. Contacts that drifted
+		// past the maximum separation were erased above; if none are left, collide again.
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].used = true;
+		}
+		cache_hit = !collided || contact_count > 0;
+	}
+
+	if (!cache_hit) {
+		collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+
+		manifold_cache.xform_A = xform_A;
+		manifold_cache.xform_B = xform_B;
+		manifold_cache.shape_A = shape_A_ptr;
+		manifold_cache.shape_B = shape_B_ptr;
+		manifold_cache.version_A = shape_A_ptr->get_version();
+		manifold_cache.version_B = shape_B_ptr->get_version();
+		manifold_cache.valid = true;
+	}
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -595,8 +647,59 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodyPair3D::get_snapshot_state(SnapshotState &r_state) const {
+	r_state.body_A = A->get_self().get_id();
+	r_state.body_B = B->get_self().get_id();
+	r_state.shape_A = shape_A;
+	r_state.shape_B = shape_B;
+	r_state.sep_axis = sep_axis;
+	r_state.contact_count = contact_count;
+
+	for (int i = 0; i < contact_count; i++) {
+		const Contact &c = contacts[i];
+		SnapshotContact &sc = r_state.contacts[i];
+		sc.local_A = c.local_A;
+		sc.local_B = c.local_B;
+		sc.normal = c.normal;
+		sc.acc_tangent_impulse = c.acc_tangent_impulse;
+		sc.acc_normal_impulse = c.acc_normal_impulse;
+		sc.acc_bias_impulse = c.acc_bias_impulse;
+		sc.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		sc.depth = c.depth;
+		sc.index_A = c.index_A;
+		sc.index_B = c.index_B;
+		sc.used = c.used ? 1 : 0;
+	}
+}
+
+void GodotBodyPair3D::set_snapshot_state(const SnapshotState &p_state) {
+	ERR_FAIL_COND(p_state.contact_count > MAX_CONTACTS);
+
+	sep_axis = p_state.sep_axis;
+	contact_count = p_state.contact_count;
+	manifold_cache.valid = false;
+
+	for (int i = 0; i < contact_count; i++) {
+		const SnapshotContact &sc = p_state.contacts[i];
+		Contact &c = contacts[i];
+		c = Contact();
+		c.local_A = sc.local_A;
+		c.local_B = sc.local_B;
+		c.normal = sc.normal;
+		c.acc_tangent_impulse = sc.acc_tangent_impulse;
+		c.acc_normal_impulse = sc.acc_normal_impulse;
+		c.acc_bias_impulse = sc.acc_bias_impulse;
+		c.acc_bias_impulse_center_of_mass = sc.acc_bias_impulse_center_of_mass;
+		c.depth = sc.depth;
+		c.index_A = sc.index_A;
+		c.index_B = sc.index_B;
+		c.used = sc.used != 0;
+	}
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
-		GodotBodyContact3D(_arr, 2) {
+		GodotBodyContact3D(_arr, 2),
+		pair_list(this) {
 	A = p_A;
 	B = p_B;
 	shape_A = p_shape_A;
@@ -604,6 +707,7 @@ GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p
 	space = A->get_space();
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
+	space->body_pair_add_to_list(&pair_list);
 }
 
 GodotBodyPair3D::~GodotBodyPair3D() {
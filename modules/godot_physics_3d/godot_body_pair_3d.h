@@ -96,14 +96,64 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Narrowphase inputs from the last time the collision solver ran, used to skip it while the shapes stay put.
+	struct ManifoldCache {
+		Transform3D xform_A;
+		Transform3D xform_B;
+		const GodotShape3D *shape_A = nullptr;
+		const GodotShape3D *shape_B = nullptr;
+		uint32_t version_A = 0;
+		uint32_t version_B = 0;
+		bool valid = false;
+	};
+
+	ManifoldCache manifold_cache;
+
+	SelfList<GodotBodyPair3D> pair_list;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
 
 	void validate_contacts();
+	bool _is_manifold_cache_valid(const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B) const;
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	// Contact manifold captured by space snapshots, including the accumulated impulses used for warm starting.
+	struct SnapshotContact {
+		Vector3 local_A;
+		Vector3 local_B;
+		Vector3 normal;
+		Vector3 acc_tangent_impulse;
+		real_t acc_normal_impulse = 0.0;
+		real_t acc_bias_impulse = 0.0;
+		real_t acc_bias_impulse_center_of_mass = 0.0;
+		real_t depth = 0.0;
+		int32_t index_A = 0;
+		int32_t index_B = 0;
+		uint32_t used = 0;
+	};
+
+	struct SnapshotState {
+		uint64_t body_A = 0;
+		uint64_t body_B = 0;
+		int32_t shape_A = 0;
+		int32_t shape_B = 0;
+		Vector3 sep_axis;
+		uint32_t contact_count = 0;
+		SnapshotContact contacts[MAX_CONTACTS];
+	};
+
+	_FORCE_INLINE_ GodotBody3D *get_body_A() const { return A; }
+	_FORCE_INLINE_ GodotBody3D *get_body_B() const { return B; }
+	_FORCE_INLINE_ int get_shape_A() const { return shape_A; }
+	_FORCE_INLINE_ int get_shape_B() const { return shape_B; }
+	_FORCE_INLINE_ bool has_contacts() const { return contact_count > 0; }
+
+	void get_snapshot_state(SnapshotState &r_state) const;
+	void set_snapshot_state(const SnapshotState &p_state);
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -2092,22 +2092,25 @@ static void _collision_convex_polygon_convex_polygon(const GodotShape3D *p_a, co
 
 	// A<->B edges
 
+	// Transform the edges of B once up front, rather than once per edge of A.
+	// Each edge is stored as its negated direction followed by its negated adjacent face normals.
+	Vector3 *edge_data_B = (Vector3 *)alloca(sizeof(Vector3) * 3 * edge_count_B);
+	for (int j = 0; j < edge_count_B; j++) {
+		edge_data_B[j * 3 + 0] = p_transform_b.basis.xform(vertices_B[edges_B[j].vertex_a] - vertices_B[edges_B[j].vertex_b]);
+		edge_data_B[j * 3 + 1] = -p_transform_b.basis.xform(faces_B[edges_B[j].face_a].plane.normal).normalized();
+		edge_data_B[j * 3 + 2] = -p_transform_b.basis.xform(faces_B[edges_B[j].face_b].plane.normal).normalized();
+	}
+
 	for (int i = 0; i < edge_count_A; i++) {
-		Vector3 p1 = p_transform_a.xform(vertices_A[edges_A[i].vertex_a]);
-		Vector3 q1 = p_transform_a.xform(vertices_A[edges_A[i].vertex_b]);
-		Vector3 e1 = q1 - p1;
+		Vector3 e1 = p_transform_a.basis.xform(vertices_A[edges_A[i].vertex_b] - vertices_A[edges_A[i].vertex_a]);
 		Vector3 u1 = p_transform_a.basis.xform(faces_A[edges_A[i].face_a].plane.normal).normalized();
 		Vector3 v1 = p_transform_a.basis.xform(faces_A[edges_A[i].face_b].plane.normal).normalized();
 
 		for (int j = 0; j < edge_count_B; j++) {
-			Vector3 p2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_a]);
-			Vector3 q2 = p_transform_b.xform(vertices_B[edges_B[j].vertex_b]);
-			Vector3 e2 = q2 - p2;
-			Vector3 u2 = p_transform_b.basis.xform(faces_B[edges_B[j].face_a].plane.normal).normalized();
-			Vector3 v2 = p_transform_b.basis.xform(faces_B[edges_B[j].face_b].plane.normal).normalized();
-
-			if (is_minkowski_face(u1, v1, -e1, -u2, -v2, -e2)) {
-				Vector3 axis = e1.cross(e2).normalized();
+			const Vector3 &neg_e2 = edge_data_B[j * 3 + 0];
+
+			if (is_minkowski_face(u1, v1, -e1, edge_data_B[j * 3 + 1], edge_data_B[j * 3 + 2], neg_e2)) {
+				Vector3 axis = neg_e2.cross(e1).normalized();
 
 				if (!separator.test_axis(axis)) {
 					return;
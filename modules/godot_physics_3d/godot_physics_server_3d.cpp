@@ -39,6 +39,7 @@
 #include "joints/godot_slider_joint_3d.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -214,6 +215,18 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+PackedByteArray GodotPhysicsServer3D::space_create_snapshot(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	return space->create_snapshot();
+}
+
+bool GodotPhysicsServer3D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	return space->restore_snapshot(p_snapshot);
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -948,6 +961,60 @@ bool GodotPhysicsServer3D::body_test_motion(RID p_body, const MotionParameters &
 	return body->get_space()->test_body_motion(body, p_parameters, r_result);
 }
 
+void GodotPhysicsServer3D::_test_motion_batch_item(uint32_t p_index, MotionBatch *p_batch) {
+	GodotBody3D *body = p_batch->bodies[p_index];
+	if (body) {
+		MotionBatchItem &item = p_batch->items[p_index];
+		item.collided = body->get_space()->test_body_motion(body, item.parameters, &item.result);
+	}
+}
+
+void GodotPhysicsServer3D::body_test_motion_batch(MotionBatchItem *p_items, int p_item_count) {
+	ERR_FAIL_COND(p_item_count < 0);
+	if (p_item_count == 0) {
+		return;
+	}
+	ERR_FAIL_NULL(p_items);
+
+	LocalVector<GodotBody3D *> bodies;
+	bodies.resize(p_item_count);
+
+	LocalVector<GodotSpace3D *> spaces;
+
+	for (int i = 0; i < p_item_count; i++) {
+		MotionBatchItem &item = p_items[i];
+		item.result = MotionResult();
+		item.collided = false;
+		bodies[i] = nullptr;
+
+		GodotBody3D *body = body_owner.get_or_null(item.body);
+		ERR_CONTINUE(body == nullptr);
+		GodotSpace3D *space = body->get_space();
+		ERR_CONTINUE(space == nullptr);
+		ERR_CONTINUE(space->is_locked());
+		ERR_CONTINUE(item.parameters.max_collisions < 0 || item.parameters.max_collisions > MotionResult::MAX_COLLISIONS);
+
+		bodies[i] = body;
+		if (!spaces.has(space)) {
+			spaces.push_back(space);
+		}
+	}
+
+	_update_shapes();
+
+	// Nothing moves while the items are tested, so they can be resolved in any order.
+	MotionBatch batch;
+	batch.items = p_items;
+	batch.bodies = bodies.ptr();
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsServer3D::_test_motion_batch_item, &batch, p_item_count, -1, true, SNAME("Physics3DTestMotionBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (GodotSpace3D *space : spaces) {
+		space->resolve_body_motion_batch(p_items, bodies.ptr(), p_item_count);
+	}
+}
+
 PhysicsDirectBodyState3D *GodotPhysicsServer3D::body_get_direct_state(RID p_body) {
 	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync), nullptr, "Body state is inaccessible right now, wait for iteration or physics process notification.");
 
@@ -1767,6 +1834,8 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 }
 
 void GodotPhysicsServer3D::_update_shapes() {
+	// Motion tests may run concurrently from sub-thread process groups, the first one flushes.
+	MutexLock lock(pending_shape_update_mutex);
 	while (pending_shape_update_list.first()) {
 		pending_shape_update_list.first()->self()->_shape_changed();
 		pending_shape_update_list.remove(pending_shape_update_list.first());
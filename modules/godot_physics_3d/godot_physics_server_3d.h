@@ -65,8 +65,16 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	//void _clear_query(QuerySW *p_query);
 	friend class GodotCollisionObject3D;
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
+	Mutex pending_shape_update_mutex;
 	void _update_shapes();
 
+	struct MotionBatch {
+		MotionBatchItem *items = nullptr;
+		GodotBody3D **bodies = nullptr;
+	};
+
+	void _test_motion_batch_item(uint32_t p_index, MotionBatch *p_batch);
+
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
@@ -116,6 +124,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override;
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
@@ -255,6 +266,7 @@ public:
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) override;
+	virtual void body_test_motion_batch(MotionBatchItem *p_items, int p_item_count) override;
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override;
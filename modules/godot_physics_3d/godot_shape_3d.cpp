@@ -68,6 +68,7 @@ const double cylinder_face_support_threshold = 0.999;
 void GodotShape3D::configure(const AABB &p_aabb) {
 	aabb = p_aabb;
 	configured = true;
+	version++;
 	for (const KeyValue<GodotShapeOwner3D *, int> &E : owners) {
 		GodotShapeOwner3D *co = E.key;
 		co->_shape_changed();
@@ -807,32 +808,86 @@ GodotCylinderShape3D::GodotCylinderShape3D() {}
 
 /********** CONVEX POLYGON *************/
 
+int GodotConvexPolygonShape3D::_soa_get_support_index(const Vector3 &p_normal) const {
+	const real_t *block = soa_vertices.ptr();
+
+	real_t lane_max[SOA_BLOCK_SIZE];
+	uint32_t lane_index[SOA_BLOCK_SIZE];
+
+	for (uint32_t j = 0; j < SOA_BLOCK_SIZE; j++) {
+		lane_max[j] = p_normal.x * block[j] + p_normal.y * block[SOA_BLOCK_SIZE + j] + p_normal.z * block[2 * SOA_BLOCK_SIZE + j];
+		lane_index[j] = j;
+	}
+
+	for (uint32_t b = 1; b < soa_block_count; b++) {
+		block += 3 * SOA_BLOCK_SIZE;
+		for (uint32_t j = 0; j < SOA_BLOCK_SIZE; j++) {
+			real_t d = p_normal.x * block[j] + p_normal.y * block[SOA_BLOCK_SIZE + j] + p_normal.z * block[2 * SOA_BLOCK_SIZE + j];
+			bool better = d > lane_max[j];
+			lane_max[j] = better ? d : lane_max[j];
+			lane_index[j] = better ? b * SOA_BLOCK_SIZE + j : lane_index[j];
+		}
+	}
+
+	// Padding repeats the first vertex, which lane 0 always sees first, so ties never pick a padding index.
+	uint32_t best_lane = 0;
+	for (uint32_t j = 1; j < SOA_BLOCK_SIZE; j++) {
+		if (lane_max[j] > lane_max[best_lane]) {
+			best_lane = j;
+		}
+	}
+
+	return lane_index[best_lane];
+}
+
+void GodotConvexPolygonShape3D::_soa_project_range(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const {
+	const real_t *block = soa_vertices.ptr();
+
+	real_t lane_min[SOA_BLOCK_SIZE];
+	real_t lane_max[SOA_BLOCK_SIZE];
+
+	for (uint32_t j = 0; j < SOA_BLOCK_SIZE; j++) {
+		lane_min[j] = lane_max[j] = p_normal.x * block[j] + p_normal.y * block[SOA_BLOCK_SIZE + j] + p_normal.z * block[2 * SOA_BLOCK_SIZE + j];
+	}
+
+	for (uint32_t b = 1; b < soa_block_count; b++) {
+		block += 3 * SOA_BLOCK_SIZE;
+		for (uint32_t j = 0; j < SOA_BLOCK_SIZE; j++) {
+			real_t d = p_normal.x * block[j] + p_normal.y * block[SOA_BLOCK_SIZE + j] + p_normal.z * block[2 * SOA_BLOCK_SIZE + j];
+			lane_min[j] = MIN(lane_min[j], d);
+			lane_max[j] = MAX(lane_max[j], d);
+		}
+	}
+
+	r_min = lane_min[0];
+	r_max = lane_max[0];
+	for (uint32_t j = 1; j < SOA_BLOCK_SIZE; j++) {
+		r_min = MIN(r_min, lane_min[j]);
+		r_max = MAX(r_max, lane_max[j]);
+	}
+}
+
 void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
 	uint32_t vertex_count = mesh.vertices.size();
 	if (vertex_count == 0) {
 		return;
 	}
 
-	const Vector3 *vrts = &mesh.vertices[0];
+	if (vertex_count <= SOA_LINEAR_SCAN_MAX) {
+		// Project onto the axis in local space, so vertices don't need to be transformed.
+		Vector3 n = p_transform.basis.xform_inv(p_normal);
+		real_t offset = p_normal.dot(p_transform.origin);
 
-	if (vertex_count > 3 * extreme_vertices.size()) {
+		_soa_project_range(n, r_min, r_max);
+		r_min += offset;
+		r_max += offset;
+	} else {
 		// For a large mesh, two calls to get_support() is faster than a full
 		// scan over all vertices.
 
 		Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
 		r_min = p_normal.dot(p_transform.xform(get_support(-n)));
 		r_max = p_normal.dot(p_transform.xform(get_support(n)));
-	} else {
-		for (uint32_t i = 0; i < vertex_count; i++) {
-			real_t d = p_normal.dot(p_transform.xform(vrts[i]));
-
-			if (i == 0 || d > r_max) {
-				r_max = d;
-			}
-			if (i == 0 || d < r_min) {
-				r_min = d;
-			}
-		}
 	}
 }
 
@@ -845,6 +900,11 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 	// Get the array of vertices
 	const Vector3 *const vertices_array = mesh.vertices.ptr();
 
+	// Small meshes are scanned in full.
+	if (mesh.vertices.size() <= SOA_LINEAR_SCAN_MAX) {
+		return vertices_array[_soa_get_support_index(p_normal)];
+	}
+
 	// Start with an initial assumption of the first extreme vertex.
 	int best_vertex = extreme_vertices[0];
 	real_t max_support = p_normal.dot(vertices_array[best_vertex]);
@@ -1134,6 +1194,30 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 			vertex_neighbors[edge.vertex_b].push_back(edge.vertex_a);
 		}
 	}
+
+	_setup_soa_vertices();
+}
+
+void GodotConvexPolygonShape3D::_setup_soa_vertices() {
+	soa_vertices.clear();
+	soa_block_count = 0;
+
+	uint32_t vertex_count = mesh.vertices.size();
+	if (vertex_count == 0 || vertex_count > SOA_LINEAR_SCAN_MAX) {
+		return;
+	}
+
+	soa_block_count = (vertex_count + SOA_BLOCK_SIZE - 1) / SOA_BLOCK_SIZE;
+	soa_vertices.resize(soa_block_count * 3 * SOA_BLOCK_SIZE);
+
+	real_t *w = soa_vertices.ptr();
+	for (uint32_t i = 0; i < soa_block_count * SOA_BLOCK_SIZE; i++) {
+		const Vector3 &v = mesh.vertices[i < vertex_count ? i : 0];
+		uint32_t block_offset = (i / SOA_BLOCK_SIZE) * 3 * SOA_BLOCK_SIZE + (i % SOA_BLOCK_SIZE);
+		w[block_offset] = v.x;
+		w[block_offset + SOA_BLOCK_SIZE] = v.y;
+		w[block_offset + 2 * SOA_BLOCK_SIZE] = v.z;
+	}
 }
 
 void GodotConvexPolygonShape3D::set_data(const Variant &p_data) {
@@ -1273,11 +1357,14 @@ Vector<Vector3> GodotConcavePolygonShape3D::get_faces() const {
 	Vector<Vector3> rfaces;
 	rfaces.resize(faces.size() * 3);
 
-	for (int i = 0; i < faces.size(); i++) {
-		Face f = faces.get(i);
+	Vector3 *rfacesw = rfaces.ptrw();
+	const Face *fr = faces.ptr();
+	const Vector3 *vr = vertices.ptr();
 
+	// Faces are stored in leaf order, return them in the order they were given.
+	for (int i = 0; i < faces.size(); i++) {
 		for (int j = 0; j < 3; j++) {
-			rfaces.set(i * 3 + j, vertices.get(f.indices[j]));
+			rfacesw[fr[i].index * 3 + j] = vr[i * 3 + j];
 		}
 	}
 
@@ -1330,44 +1417,6 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
-
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
-
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->face_index = face_index;
-				p_params->collisions++;
-			}
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
-	}
-}
-
 bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
 	if (faces.is_empty()) {
 		return false;
@@ -1381,70 +1430,104 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	GodotFaceShape3D face;
 	face.backface_collision = backface_collision && p_hit_back_faces;
 
-	_SegmentCullParams params;
-	params.from = p_begin;
-	params.to = p_end;
-	params.dir = (p_end - p_begin).normalized();
-
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
-
-	params.face = &face;
-
-	// cull
-	_cull_segment(0, &params);
-
-	if (params.collisions > 0) {
-		r_result = params.result;
-		r_normal = params.normal;
-		r_face_index = params.face_index;
-		return true;
-	} else {
+	const Vector3 segment = p_end - p_begin;
+	const real_t segment_length = segment.length();
+	if (segment_length == 0) {
 		return false;
 	}
-}
+	const Vector3 dir = segment / segment_length;
 
-bool GodotConcavePolygonShape3D::intersect_point(const Vector3 &p_point) const {
-	return false; //face is flat
-}
+	Vector3 inv_segment;
+	for (int i = 0; i < 3; i++) {
+		inv_segment[i] = segment[i] != 0 ? 1.0 / segment[i] : 0.0;
+	}
 
-Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point) const {
-	return Vector3();
-}
+	// Nodes are visited front to back, and the segment is clipped to the closest hit found so far.
+	real_t max_t = 1.0;
+	real_t min_d = 1e20;
+	int collisions = 0;
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+	struct StackEntry {
+		uint32_t node = 0;
+		real_t t = 0.0;
+	};
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
+	StackEntry stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+
+	real_t root_t;
+	if (_intersect_bvh_node_segment(br[0], p_begin, segment, inv_segment, max_t, root_t)) {
+		stack[stack_size++] = { 0, root_t };
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
+	while (stack_size > 0) {
+		const StackEntry entry = stack[--stack_size];
+		if (entry.t > max_t) {
+			continue;
 		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
+		const BVH &node = br[entry.node];
+
+		if (node.data & BVH_LEAF_FLAG) {
+			const uint32_t first = (node.data & ~BVH_LEAF_FLAG) >> 2;
+			const uint32_t count = (node.data & 3) + 1;
+
+			for (uint32_t i = first; i < first + count; i++) {
+				face.normal = fr[i].normal;
+				face.vertex[0] = vr[i * 3 + 0];
+				face.vertex[1] = vr[i * 3 + 1];
+				face.vertex[2] = vr[i * 3 + 2];
+
+				Vector3 res;
+				Vector3 normal;
+				int face_index = fr[i].index;
+				if (face.intersect_segment(p_begin, p_end, res, normal, face_index, true)) {
+					real_t d = dir.dot(res) - dir.dot(p_begin);
+					if ((d > 0) && (d < min_d)) {
+						min_d = d;
+						max_t = MIN(max_t, d / segment_length);
+						r_result = res;
+						r_normal = normal;
+						r_face_index = fr[i].index;
+						collisions++;
+					}
+				}
+			}
+		} else {
+			const uint32_t left = entry.node + 1;
+			const uint32_t right = node.data;
+
+			real_t left_t;
+			real_t right_t;
+			const bool hit_left = _intersect_bvh_node_segment(br[left], p_begin, segment, inv_segment, max_t, left_t);
+			const bool hit_right = _intersect_bvh_node_segment(br[right], p_begin, segment, inv_segment, max_t, right_t);
+
+			// Push the farthest child first, so the closest one is visited next.
+			if (hit_left && hit_right) {
+				if (left_t < right_t) {
+					stack[stack_size++] = { right, right_t };
+					stack[stack_size++] = { left, left_t };
+				} else {
+					stack[stack_size++] = { left, left_t };
+					stack[stack_size++] = { right, right_t };
+				}
+			} else if (hit_left) {
+				stack[stack_size++] = { left, left_t };
+			} else if (hit_right) {
+				stack[stack_size++] = { right, right_t };
 			}
 		}
 	}
 
-	return false;
+	return collisions > 0;
+}
+
+bool GodotConcavePolygonShape3D::intersect_point(const Vector3 &p_point) const {
+	return false; //face is flat
+}
+
+Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point) const {
+	return Vector3();
 }
 
 void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
@@ -1453,7 +1536,14 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	if (!p_local_aabb.intersects(get_aabb())) {
+		return;
+	}
+
+	// Quantize the query once, so nodes are tested with integer comparisons.
+	uint16_t query_min[3];
+	uint16_t query_max[3];
+	_quantize_bvh_bounds(p_local_aabb, query_min, query_max);
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1464,17 +1554,39 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.backface_collision = backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	_CullParams params;
-	params.aabb = local_aabb;
-	params.face = &face;
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
-	params.callback = p_callback;
-	params.userdata = p_userdata;
+	uint32_t stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const uint32_t node_index = stack[--stack_size];
+		const BVH &node = br[node_index];
+
+		if (node.min[0] > query_max[0] || node.max[0] < query_min[0] ||
+				node.min[1] > query_max[1] || node.max[1] < query_min[1] ||
+				node.min[2] > query_max[2] || node.max[2] < query_min[2]) {
+			continue;
+		}
 
-	// cull
-	_cull(0, &params);
+		if (node.data & BVH_LEAF_FLAG) {
+			const uint32_t first = (node.data & ~BVH_LEAF_FLAG) >> 2;
+			const uint32_t count = (node.data & 3) + 1;
+
+			for (uint32_t i = first; i < first + count; i++) {
+				face.normal = fr[i].normal;
+				face.vertex[0] = vr[i * 3 + 0];
+				face.vertex[1] = vr[i * 3 + 1];
+				face.vertex[2] = vr[i * 3 + 2];
+				if (p_callback(p_userdata, &face)) {
+					return;
+				}
+			}
+		} else {
+			// Left child is visited first.
+			stack[stack_size++] = node.data;
+			stack[stack_size++] = node_index + 1;
+		}
+	}
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1511,97 +1623,167 @@ struct _Volume_BVH_CompareZ {
 	}
 };
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
-
-	int face_index = 0;
-};
+static _FORCE_INLINE_ real_t _bvh_half_area(const AABB &p_aabb) {
+	const Vector3 &size = p_aabb.size;
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
-	}
+void GodotConcavePolygonShape3D::_quantize_bvh_bounds(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const {
+	const Vector3 end = p_aabb.get_end();
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
+	for (int i = 0; i < 3; i++) {
+		real_t qmin = Math::floor((p_aabb.position[i] - bvh_origin[i]) * bvh_inv_scale[i]);
+		real_t qmax = Math::ceil((end[i] - bvh_origin[i]) * bvh_inv_scale[i]);
+		int imin = CLAMP(int(qmin), 0, 65535);
+		int imax = CLAMP(int(qmax), 0, 65535);
+
+		// Rounding must never shrink the bounds.
+		if (imin > 0 && bvh_origin[i] + imin * bvh_scale[i] > p_aabb.position[i]) {
+			imin--;
+		}
+		if (imax < 65535 && bvh_origin[i] + imax * bvh_scale[i] < end[i]) {
+			imax++;
 		}
+
+		r_min[i] = imin;
+		r_max[i] = imax;
 	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
-		case 0: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
+}
 
-		} break;
-		case 1: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
-		} break;
-		case 2: {
-			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
-		} break;
+uint32_t GodotConcavePolygonShape3D::_build_bvh(_Volume_BVH_Element *p_elements, int p_count, int p_depth, LocalVector<BVH> &r_nodes, LocalVector<int> &r_face_order) const {
+	AABB aabb = p_elements[0].aabb;
+	AABB center_aabb(p_elements[0].center, Vector3());
+	for (int i = 1; i < p_count; i++) {
+		aabb.merge_with(p_elements[i].aabb);
+		center_aabb.expand_to(p_elements[i].center);
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
+	const uint32_t node_index = r_nodes.size();
+	r_nodes.push_back(BVH());
+	_quantize_bvh_bounds(aabb, r_nodes[node_index].min, r_nodes[node_index].max);
 
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
+	const int axis = center_aabb.get_longest_axis_index();
+	const real_t extent = center_aabb.size[axis];
+	int split = 0;
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+	if (p_count > 1 && p_depth < BVH_SAH_MAX_DEPTH && extent > CMP_EPSILON) {
+		// Binned surface area heuristic along the axis where face centers spread the most.
+		struct Bin {
+			AABB aabb;
+			int count = 0;
+		};
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+		Bin bins[BVH_SAH_BINS];
+		const real_t origin = center_aabb.position[axis];
+		const real_t bin_scale = BVH_SAH_BINS * (1.0 - CMP_EPSILON) / extent;
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+		for (int i = 0; i < p_count; i++) {
+			const int b = MIN(int((p_elements[i].center[axis] - origin) * bin_scale), BVH_SAH_BINS - 1);
+			if (bins[b].count == 0) {
+				bins[b].aabb = p_elements[i].aabb;
+			} else {
+				bins[b].aabb.merge_with(p_elements[i].aabb);
+			}
+			bins[b].count++;
+		}
 
-	} else {
-		p_bvh_array[p_idx].left = -1;
+		real_t right_area[BVH_SAH_BINS];
+		int right_count[BVH_SAH_BINS];
+		{
+			AABB right_aabb;
+			int count = 0;
+			for (int i = BVH_SAH_BINS - 1; i > 0; i--) {
+				if (bins[i].count > 0) {
+					right_aabb = count == 0 ? bins[i].aabb : right_aabb.merge(bins[i].aabb);
+					count += bins[i].count;
+				}
+				right_area[i] = count > 0 ? _bvh_half_area(right_aabb) : 0.0;
+				right_count[i] = count;
+			}
+		}
+
+		int best_bin = -1;
+		real_t best_cost = 0.0;
+		{
+			AABB left_aabb;
+			int count = 0;
+			for (int i = 0; i < BVH_SAH_BINS - 1; i++) {
+				if (bins[i].count > 0) {
+					left_aabb = count == 0 ? bins[i].aabb : left_aabb.merge(bins[i].aabb);
+					count += bins[i].count;
+				}
+				if (count == 0 || right_count[i + 1] == 0) {
+					continue;
+				}
+				const real_t cost = count * _bvh_half_area(left_aabb) + right_count[i + 1] * right_area[i + 1];
+				if (best_bin < 0 || cost < best_cost) {
+					best_bin = i;
+					best_cost = cost;
+				}
+			}
+		}
+
+		// Splitting costs one extra node traversal, small leaves are kept when that does not pay off.
+		const real_t node_area = _bvh_half_area(aabb);
+		const bool keep_leaf = p_count <= BVH_MAX_LEAF_FACES && best_cost + node_area >= p_count * node_area;
+
+		if (best_bin >= 0 && !keep_leaf) {
+			for (int i = 0; i < p_count; i++) {
+				const int b = MIN(int((p_elements[i].center[axis] - origin) * bin_scale), BVH_SAH_BINS - 1);
+				if (b <= best_bin) {
+					SWAP(p_elements[i], p_elements[split]);
+					split++;
+				}
+			}
+		}
 	}
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
+	if (split == 0 && p_count > BVH_MAX_LEAF_FACES) {
+		// Faces that can't be told apart by their centers, or too deep: split at the median.
+		switch (axis) {
+			case 0: {
+				SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
+				sort_x.sort(p_elements, p_count);
+			} break;
+			case 1: {
+				SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
+				sort_y.sort(p_elements, p_count);
+			} break;
+			case 2: {
+				SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
+				sort_z.sort(p_elements, p_count);
+			} break;
+		}
+		split = p_count / 2;
+	}
 
-	} else {
-		p_bvh_array[p_idx].right = -1;
+	if (split == 0) {
+		r_nodes[node_index].data = BVH_LEAF_FLAG | (r_face_order.size() << 2) | uint32_t(p_count - 1);
+		for (int i = 0; i < p_count; i++) {
+			r_face_order.push_back(p_elements[i].face_index);
+		}
+		return node_index;
 	}
 
-	memdelete(p_bvh_tree);
+	_build_bvh(p_elements, split, p_depth + 1, r_nodes, r_face_order);
+	const uint32_t right = _build_bvh(&p_elements[split], p_count - split, p_depth + 1, r_nodes, r_face_order);
+	r_nodes[node_index].data = right;
+
+	return node_index;
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
+		faces.clear();
+		vertices.clear();
+		bvh.clear();
 		configure(AABB());
 		return;
 	}
 	ERR_FAIL_COND(src_face_count % 3);
 	src_face_count /= 3;
+	ERR_FAIL_COND_MSG(uint32_t(src_face_count) >= (BVH_LEAF_FLAG >> 2), "Too many faces in concave polygon shape.");
 
 	const Vector3 *facesr = p_faces.ptr();
 
@@ -1610,13 +1792,6 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
 
-	faces.resize(src_face_count);
-	Face *facesw = faces.ptrw();
-
-	vertices.resize(src_face_count * 3);
-
-	Vector3 *verticesw = vertices.ptrw();
-
 	AABB _aabb;
 
 	for (int i = 0; i < src_face_count; i++) {
@@ -1625,13 +1800,6 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		bvh_arrayw[i].aabb = face.get_aabb();
 		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
 		bvh_arrayw[i].face_index = i;
-		facesw[i].indices[0] = i * 3 + 0;
-		facesw[i].indices[1] = i * 3 + 1;
-		facesw[i].indices[2] = i * 3 + 2;
-		facesw[i].normal = face.get_plane().normal;
-		verticesw[i * 3 + 0] = face.vertex[0];
-		verticesw[i * 3 + 1] = face.vertex[1];
-		verticesw[i * 3 + 2] = face.vertex[2];
 		if (i == 0) {
 			_aabb = bvh_arrayw[i].aabb;
 		} else {
@@ -1639,15 +1807,41 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
+	// Slightly larger than the faces, so dequantized bounds are never short of them.
+	const AABB quantization_aabb = _aabb.grow(_aabb.get_longest_axis_size() * CMP_EPSILON);
+	bvh_origin = quantization_aabb.position;
+	for (int i = 0; i < 3; i++) {
+		bvh_scale[i] = quantization_aabb.size[i] / 65535.0;
+		bvh_inv_scale[i] = quantization_aabb.size[i] > 0 ? 65535.0 / quantization_aabb.size[i] : 0.0;
+	}
+
+	LocalVector<BVH> nodes;
+	nodes.reserve(src_face_count);
+	LocalVector<int> face_order;
+	face_order.reserve(src_face_count);
+
+	_build_bvh(bvh_arrayw, src_face_count, 0, nodes, face_order);
+
+	bvh.resize(nodes.size());
+	memcpy(bvh.ptrw(), nodes.ptr(), nodes.size() * sizeof(BVH));
 
-	bvh.resize(count + 1);
+	// Store the faces in leaf order.
+	faces.resize(src_face_count);
+	Face *facesw = faces.ptrw();
+
+	vertices.resize(src_face_count * 3);
+	Vector3 *verticesw = vertices.ptrw();
 
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	for (int i = 0; i < src_face_count; i++) {
+		const int src = face_order[i];
+		Face3 face(facesr[src * 3 + 0], facesr[src * 3 + 1], facesr[src * 3 + 2]);
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+		facesw[i].normal = face.get_plane().normal;
+		facesw[i].index = src;
+		verticesw[i * 3 + 0] = face.vertex[0];
+		verticesw[i * 3 + 1] = face.vertex[1];
+		verticesw[i * 3 + 2] = face.vertex[2];
+	}
 
 	backface_collision = p_backface_collision;
 
@@ -1675,7 +1869,18 @@ GodotConcavePolygonShape3D::GodotConcavePolygonShape3D() {
 /* HEIGHT MAP SHAPE */
 
 Vector<real_t> GodotHeightMapShape3D::get_heights() const {
-	return heights;
+	if (!half_precision) {
+		return heights;
+	}
+
+	Vector<real_t> result;
+	result.resize(half_heights.size());
+	real_t *w = result.ptrw();
+	const uint16_t *r = half_heights.ptr();
+	for (int i = 0; i < half_heights.size(); i++) {
+		w[i] = Math::half_to_float(r[i]);
+	}
+	return result;
 }
 
 int GodotHeightMapShape3D::get_width() const {
@@ -1754,41 +1959,6 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
-
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
-
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
-	}
-
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
-}
-
 template <typename ProcessFunction>
 bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const {
 	Vector3 delta = (p_end - p_begin);
@@ -1930,8 +2100,103 @@ bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process,
 	return false;
 }
 
+bool GodotHeightMapShape3D::_get_bounds_mip_segment_range(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, real_t &r_enter, real_t &r_exit) const {
+	const Range &range = bounds_mips[p_level].get(p_x, p_z);
+	const int cells = BOUNDS_CHUNK_SIZE << p_level;
+
+	// Chunks include the first row and column of vertices of their neighbors.
+	Vector3 node_min(p_x * cells, range.min, p_z * cells);
+	Vector3 node_max(MIN((p_x + 1) * cells, width - 1), range.max, MIN((p_z + 1) * cells, depth - 1));
+	node_min -= local_origin;
+	node_max -= local_origin;
+
+	const Vector3 delta = p_end - p_begin;
+	real_t enter = 0.0;
+	real_t exit = 1.0;
+
+	for (int i = 0; i < 3; i++) {
+		if (Math::abs(delta[i]) < CMP_EPSILON) {
+			if (p_begin[i] < node_min[i] || p_begin[i] > node_max[i]) {
+				return false;
+			}
+			continue;
+		}
+
+		real_t t0 = (node_min[i] - p_begin[i]) / delta[i];
+		real_t t1 = (node_max[i] - p_begin[i]) / delta[i];
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
+		enter = MAX(enter, t0);
+		exit = MIN(exit, t1);
+		if (enter > exit) {
+			return false;
+		}
+	}
+
+	r_enter = enter;
+	r_exit = exit;
+	return true;
+}
+
+bool GodotHeightMapShape3D::_intersect_bounds_mip_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	real_t enter;
+	real_t exit;
+	if (!_get_bounds_mip_segment_range(p_level, p_x, p_z, p_begin, p_end, enter, exit)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		// March the cells of the chunk between the points where the segment enters and exits its bounds.
+		const Vector3 delta = p_end - p_begin;
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin + delta * enter, p_begin + delta * exit, width, depth, local_origin, r_point, r_normal);
+	}
+
+	struct Child {
+		int x = 0;
+		int z = 0;
+		real_t enter = 0.0;
+	};
+
+	Child children[4];
+	int child_count = 0;
+
+	const BoundsMip &child_mip = bounds_mips[p_level - 1];
+	const int child_end_x = MIN(p_x * 2 + 2, child_mip.width);
+	const int child_end_z = MIN(p_z * 2 + 2, child_mip.depth);
+
+	for (int z = p_z * 2; z < child_end_z; z++) {
+		for (int x = p_x * 2; x < child_end_x; x++) {
+			real_t child_enter;
+			real_t child_exit;
+			if (!_get_bounds_mip_segment_range(p_level - 1, x, z, p_begin, p_end, child_enter, child_exit)) {
+				continue;
+			}
+
+			// Keep children sorted front to back.
+			int i = child_count++;
+			while (i > 0 && children[i - 1].enter > child_enter) {
+				children[i] = children[i - 1];
+				i--;
+			}
+			children[i].x = x;
+			children[i].z = z;
+			children[i].enter = child_enter;
+		}
+	}
+
+	// Children don't overlap along the segment, so the first hit is the closest one.
+	for (int i = 0; i < child_count; i++) {
+		if (_intersect_bounds_mip_segment(p_level - 1, children[i].x, children[i].z, p_begin, p_end, r_point, r_normal)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
-	if (heights.is_empty()) {
+	if (heights.is_empty() && half_heights.is_empty()) {
 		return false;
 	}
 
@@ -1966,7 +2231,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_mips.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1976,15 +2241,8 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			// Plus 1 here to width and depth of the chunk because _intersect_grid_segment() is used by cell level as well,
-			// and in _intersect_grid_segment() the loop will exit 1 early because for cell point triangle lookup, it dose x + 1, z + 1 etc for the vertex.
-			int bounds_width = bounds_grid_width + 1;
-			int bounds_depth = bounds_grid_depth + 1;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_width, bounds_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, descend the min/max mips from the single top range.
+			return _intersect_bounds_mip_segment(bounds_mips.size() - 1, 0, 0, p_begin, p_end, r_point, r_normal);
 		}
 	}
 
@@ -2013,7 +2271,7 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 }
 
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
-	if (heights.is_empty()) {
+	if (heights.is_empty() && half_heights.is_empty()) {
 		return;
 	}
 
@@ -2075,10 +2333,10 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 }
 
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+	bounds_mips.clear();
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
 		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
@@ -2088,20 +2346,48 @@ void GodotHeightMapShape3D::_build_accelerator() {
 		++bounds_grid_depth;
 	}
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
-
-	if (bound_grid_size < 2) {
+	if (bounds_grid_width * bounds_grid_depth < 2) {
 		// Grid is empty or just one chunk.
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
+	int mip_width = bounds_grid_width;
+	int mip_depth = bounds_grid_depth;
+	while (true) {
+		bounds_mips.push_back(BoundsMip());
+		BoundsMip &mip = bounds_mips[bounds_mips.size() - 1];
+		mip.width = mip_width;
+		mip.depth = mip_depth;
+		mip.ranges.resize(mip_width * mip_depth);
+
+		if (mip_width == 1 && mip_depth == 1) {
+			break;
+		}
+		mip_width = (mip_width + 1) / 2;
+		mip_depth = (mip_depth + 1) / 2;
+	}
 
-	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+	_update_accelerator(0, 0, width, depth);
+}
+
+void GodotHeightMapShape3D::_update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	if (bounds_mips.is_empty()) {
+		return;
+	}
+
+	// Find the chunks containing the changed vertices, including the ones
+	// that only share their first row or column with the region.
+	BoundsMip &chunks = bounds_mips[0];
+	int from_x = MAX(0, (p_from_x - 1) / BOUNDS_CHUNK_SIZE);
+	int from_z = MAX(0, (p_from_z - 1) / BOUNDS_CHUNK_SIZE);
+	int to_x = MIN(chunks.width - 1, (p_to_x - 1) / BOUNDS_CHUNK_SIZE);
+	int to_z = MIN(chunks.depth - 1, (p_to_z - 1) / BOUNDS_CHUNK_SIZE);
+
+	// Compute min and max height for the chunks.
+	for (int cz = from_z; cz <= to_z; ++cz) {
 		int z0 = cz * BOUNDS_CHUNK_SIZE;
 
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		for (int cx = from_x; cx <= to_x; ++cx) {
 			int x0 = cx * BOUNDS_CHUNK_SIZE;
 
 			Range r;
@@ -2138,13 +2424,58 @@ void GodotHeightMapShape3D::_build_accelerator() {
 				}
 			}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+			chunks.ranges[cx + cz * chunks.width] = r;
+		}
+	}
+
+	// Propagate to the coarser levels.
+	for (uint32_t level = 1; level < bounds_mips.size(); level++) {
+		const BoundsMip &child_mip = bounds_mips[level - 1];
+		BoundsMip &mip = bounds_mips[level];
+
+		from_x /= 2;
+		from_z /= 2;
+		to_x /= 2;
+		to_z /= 2;
+
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				Range r = child_mip.get(x * 2, z * 2);
+				const int child_end_x = MIN(x * 2 + 2, child_mip.width);
+				const int child_end_z = MIN(z * 2 + 2, child_mip.depth);
+				for (int cz = z * 2; cz < child_end_z; cz++) {
+					for (int cx = x * 2; cx < child_end_x; cx++) {
+						const Range &child = child_mip.get(cx, cz);
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				mip.ranges[x + z * mip.width] = r;
+			}
 		}
 	}
 }
 
-void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
-	heights = p_heights;
+void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height, bool p_half_precision) {
+	half_precision = p_half_precision;
+	if (half_precision) {
+		heights.clear();
+		half_heights.resize(p_heights.size());
+
+		uint16_t *w = half_heights.ptrw();
+		const real_t *r = p_heights.ptr();
+		for (int i = 0; i < p_heights.size(); i++) {
+			w[i] = Math::make_half_float(r[i]);
+
+			// Rounding may move heights slightly outside of the given range.
+			const real_t height = Math::half_to_float(w[i]);
+			p_min_height = MIN(p_min_height, height);
+			p_max_height = MAX(p_max_height, height);
+		}
+	} else {
+		heights = p_heights;
+		half_heights.clear();
+	}
 	width = p_width;
 	depth = p_depth;
 
@@ -2164,6 +2495,36 @@ void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width,
 	configure(aabb_new);
 }
 
+void GodotHeightMapShape3D::_update_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height) {
+	const real_t *r = p_heights.ptr();
+
+	if (half_precision) {
+		uint16_t *w = half_heights.ptrw();
+		for (int z = 0; z < p_region.size.y; z++) {
+			for (int x = 0; x < p_region.size.x; x++) {
+				uint16_t &height = w[(p_region.position.y + z) * width + p_region.position.x + x];
+				height = Math::make_half_float(r[z * p_region.size.x + x]);
+				p_min_height = MIN(p_min_height, Math::half_to_float(height));
+				p_max_height = MAX(p_max_height, Math::half_to_float(height));
+			}
+		}
+	} else {
+		real_t *w = heights.ptrw();
+		for (int z = 0; z < p_region.size.y; z++) {
+			memcpy(&w[(p_region.position.y + z) * width + p_region.position.x], &r[z * p_region.size.x], p_region.size.x * sizeof(real_t));
+		}
+	}
+
+	// Only the chunks covering the region and their parents need to be updated.
+	_update_accelerator(p_region.position.x, p_region.position.y, p_region.get_end().x, p_region.get_end().y);
+
+	AABB aabb_new = get_aabb();
+	aabb_new.position.y = p_min_height;
+	aabb_new.size.y = p_max_height - p_min_height;
+
+	configure(aabb_new);
+}
+
 void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 	ERR_FAIL_COND(p_data.get_type() != Variant::DICTIONARY);
 
@@ -2217,9 +2578,9 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		int heights_size = heights_buffer.size();
 		for (int i = 0; i < heights_size; ++i) {
-			real_t h = heights[i];
+			real_t h = heights_buffer[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
@@ -2230,10 +2591,29 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 
 	ERR_FAIL_COND(min_height > max_height);
 
+	if (d.has("region")) {
+		// Partial update, the heights only cover the region and the min and max
+		// heights (if given) are those of the whole map.
+		const Rect2i region = d["region"];
+		ERR_FAIL_COND_MSG(width_new != width || depth_new != depth, "Heightmap region updates can't change the size of the map.");
+		ERR_FAIL_COND(region.size.x <= 0 || region.size.y <= 0);
+		ERR_FAIL_COND(region.position.x < 0 || region.position.y < 0 || region.get_end().x > width || region.get_end().y > depth);
+		ERR_FAIL_COND(heights_buffer.size() != (region.size.x * region.size.y));
+
+		if (!d.has("min_height") || !d.has("max_height")) {
+			const AABB &shape_aabb = get_aabb();
+			min_height = MIN(min_height, shape_aabb.position.y);
+			max_height = MAX(max_height, shape_aabb.position.y + shape_aabb.size.y);
+		}
+
+		_update_region(region, heights_buffer, min_height, max_height);
+		return;
+	}
+
 	ERR_FAIL_COND(heights_buffer.size() != (width_new * depth_new));
 
 	// If specified, min and max height will be used as precomputed values.
-	_setup(heights_buffer, width_new, depth_new, min_height, max_height);
+	_setup(heights_buffer, width_new, depth_new, min_height, max_height, d.get("half_precision", false));
 }
 
 Variant GodotHeightMapShape3D::get_data() const {
@@ -2245,7 +2625,8 @@ Variant GodotHeightMapShape3D::get_data() const {
 	d["min_height"] = shape_aabb.position.y;
 	d["max_height"] = shape_aabb.position.y + shape_aabb.size.y;
 
-	d["heights"] = heights;
+	d["heights"] = get_heights();
+	d["half_precision"] = half_precision;
 
 	return d;
 }
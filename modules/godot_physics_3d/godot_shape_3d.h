@@ -49,6 +49,7 @@ class GodotShape3D {
 	AABB aabb;
 	bool configured = false;
 	real_t custom_bias = 0.0;
+	uint32_t version = 0;
 
 	HashMap<GodotShapeOwner3D *, int> owners;
 
@@ -72,6 +73,8 @@ public:
 
 	_FORCE_INLINE_ const AABB &get_aabb() const { return aabb; }
 	_FORCE_INLINE_ bool is_configured() const { return configured; }
+	// Incremented whenever the shape data changes, so cached collision results can be invalidated.
+	_FORCE_INLINE_ uint32_t get_version() const { return version; }
 
 	virtual bool is_concave() const { return false; }
 
@@ -275,11 +278,26 @@ public:
 };
 
 struct GodotConvexPolygonShape3D : public GodotShape3D {
+	enum {
+		SOA_BLOCK_SIZE = 8,
+		// Up to this many vertices, a branchless scan over the SoA blocks is faster than walking vertex neighbors.
+		SOA_LINEAR_SCAN_MAX = 128,
+	};
+
 	Geometry3D::MeshData mesh;
 	LocalVector<int> extreme_vertices;
 	LocalVector<LocalVector<int>> vertex_neighbors;
 
+	// Vertices in blocks of SOA_BLOCK_SIZE x, then y, then z components, padded by repeating the first vertex.
+	// Fixed-size inner loops over a block are easily vectorized by the compiler.
+	LocalVector<real_t> soa_vertices;
+	uint32_t soa_block_count = 0;
+
 	void _setup(const Vector<Vector3> &p_vertices);
+	void _setup_soa_vertices();
+
+	int _soa_get_support_index(const Vector3 &p_normal) const;
+	void _soa_project_range(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const;
 
 public:
 	const Geometry3D::MeshData &get_mesh() const { return mesh; }
@@ -301,7 +319,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -309,54 +327,83 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	struct Face {
 		Vector3 normal;
-		int indices[3] = {};
+		int index = 0; // Index of the face in the source data.
 	};
 
+	// Faces are stored in the order of the BVH leaves, with three vertices each,
+	// so the triangles of a leaf are contiguous in memory.
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
-	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+	enum {
+		BVH_MAX_LEAF_FACES = 4,
+		BVH_SAH_BINS = 16,
+		BVH_SAH_MAX_DEPTH = 64, // Deeper nodes are split at the median, keeping traversal stacks bounded.
+		BVH_STACK_SIZE = 128,
 	};
 
-	Vector<BVH> bvh;
+	static constexpr uint32_t BVH_LEAF_FLAG = 1u << 31;
 
-	struct _CullParams {
-		AABB aabb;
-		QueryCallback callback = nullptr;
-		void *userdata = nullptr;
-		const Face *faces = nullptr;
-		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
-		GodotFaceShape3D *face = nullptr;
+	// Bounds are quantized to 16 bits per axis within the shape's AABB, rounding outwards.
+	// Nodes are laid out depth first, so the left child of an inner node is the next node.
+	// Inner nodes store the index of their right child in data, leaves store BVH_LEAF_FLAG,
+	// the index of their first face shifted by 2, and their face count minus one.
+	struct BVH {
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		uint32_t data = 0;
 	};
 
-	struct _SegmentCullParams {
-		Vector3 from;
-		Vector3 to;
-		Vector3 dir;
-		const Face *faces = nullptr;
-		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
-		GodotFaceShape3D *face = nullptr;
+	static_assert(sizeof(BVH) == 16);
 
-		Vector3 result;
-		Vector3 normal;
-		int face_index = -1;
-		real_t min_d = 1e20;
-		int collisions = 0;
-	};
+	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_scale;
+	Vector3 bvh_inv_scale;
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	_FORCE_INLINE_ void _get_bvh_node_bounds(const BVH &p_node, Vector3 &r_min, Vector3 &r_max) const {
+		for (int i = 0; i < 3; i++) {
+			r_min[i] = bvh_origin[i] + p_node.min[i] * bvh_scale[i];
+			r_max[i] = bvh_origin[i] + p_node.max[i] * bvh_scale[i];
+		}
+	}
+
+	// Returns the parameter along the segment at which it enters the node, clipped to [0, p_max_t].
+	_FORCE_INLINE_ bool _intersect_bvh_node_segment(const BVH &p_node, const Vector3 &p_from, const Vector3 &p_segment, const Vector3 &p_inv_segment, real_t p_max_t, real_t &r_t) const {
+		Vector3 node_min;
+		Vector3 node_max;
+		_get_bvh_node_bounds(p_node, node_min, node_max);
+
+		real_t t_min = 0.0;
+		real_t t_max = p_max_t;
+		for (int i = 0; i < 3; i++) {
+			if (p_segment[i] == 0) {
+				if (p_from[i] < node_min[i] || p_from[i] > node_max[i]) {
+					return false;
+				}
+				continue;
+			}
+
+			real_t t0 = (node_min[i] - p_from[i]) * p_inv_segment[i];
+			real_t t1 = (node_max[i] - p_from[i]) * p_inv_segment[i];
+			if (t0 > t1) {
+				SWAP(t0, t1);
+			}
+			t_min = MAX(t_min, t0);
+			t_max = MIN(t_max, t1);
+			if (t_min > t_max) {
+				return false;
+			}
+		}
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+		r_t = t_min;
+		return true;
+	}
+
+	void _quantize_bvh_bounds(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const;
+	uint32_t _build_bvh(_Volume_BVH_Element *p_elements, int p_count, int p_depth, LocalVector<BVH> &r_nodes, LocalVector<int> &r_face_order) const;
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -384,6 +431,8 @@ public:
 
 struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	Vector<real_t> heights;
+	Vector<uint16_t> half_heights; // Used instead of heights with half precision storage.
+	bool half_precision = false;
 	int width = 0;
 	int depth = 0;
 	Vector3 local_origin;
@@ -393,17 +442,24 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
 
-	static const int BOUNDS_CHUNK_SIZE = 16;
+	// Min and max heights per chunk in the first level, then per 2x2 ranges of
+	// the level below, up to a single range covering the whole map.
+	struct BoundsMip {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
 
-	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
-	}
+		_FORCE_INLINE_ const Range &get(int p_x, int p_z) const { return ranges[(p_z * width) + p_x]; }
+	};
+	LocalVector<BoundsMip> bounds_mips;
+
+	static const int BOUNDS_CHUNK_SIZE = 16;
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
+		if (half_precision) {
+			return Math::half_to_float(half_heights[(p_z * width) + p_x]);
+		}
 		return heights[(p_z * width) + p_x];
 	}
 
@@ -416,11 +472,15 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
 	void _build_accelerator();
+	void _update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z);
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _intersect_bounds_mip_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _get_bounds_mip_segment_range(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, real_t &r_enter, real_t &r_exit) const;
 
-	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
+	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height, bool p_half_precision);
+	void _update_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height);
 
 public:
 	Vector<real_t> get_heights() const;
@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering_server.h"
 
 // Based on Bullet soft body.
@@ -194,7 +195,7 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
-void GodotSoftBody3D::update_bounds() {
+bool GodotSoftBody3D::compute_bounds() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
@@ -202,8 +203,7 @@ void GodotSoftBody3D::update_bounds() {
 
 	const uint32_t nodes_count = nodes.size();
 	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
+		return false;
 	}
 
 	bool first = true;
@@ -221,9 +221,22 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
-	if (get_space()) {
-		initialize_shape(moved);
+	return moved;
+}
+
+void GodotSoftBody3D::update_bounds() {
+	bounds_moved = compute_bounds();
+	update_shape_bounds();
+}
+
+void GodotSoftBody3D::update_shape_bounds() {
+	// Not thread-safe, this moves the shape in the broadphase.
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+	} else if (get_space()) {
+		initialize_shape(bounds_moved);
 	}
+	bounds_moved = false;
 }
 
 void GodotSoftBody3D::update_constants() {
@@ -482,6 +495,27 @@ void GodotSoftBody3D::apply_node_bias_impulse(uint32_t p_node_index, const Vecto
 	node.bv += p_impulse * node.im;
 }
 
+uint32_t GodotSoftBody3D::get_link_count() const {
+	return links.size();
+}
+
+void GodotSoftBody3D::get_link_nodes(uint32_t p_link_index, uint32_t &r_node_1, uint32_t &r_node_2) const {
+	ERR_FAIL_UNSIGNED_INDEX(p_link_index, links.size());
+	const Link &link = links[p_link_index];
+	r_node_1 = link.n[0]->index;
+	r_node_2 = link.n[1]->index;
+}
+
+int GodotSoftBody3D::get_link_color(uint32_t p_link_index) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_link_index, links.size(), -1);
+	for (uint32_t color = 0; color + 1 < link_color_offsets.size(); ++color) {
+		if (p_link_index < link_color_offsets[color + 1]) {
+			return color < MAX_LINK_COLORS ? (int)color : -1;
+		}
+	}
+	return -1;
+}
+
 uint32_t GodotSoftBody3D::get_face_count() const {
 	return faces.size();
 }
@@ -610,7 +644,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 	}
 
 	generate_bending_constraints(2);
-	reoptimize_link_order();
+	color_links();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -717,142 +751,63 @@ void GodotSoftBody3D::generate_bending_constraints(int p_distance) {
 	}
 }
 
-//===================================================================
-//
-//
-// This function takes in a list of interdependent Links and tries
-// to maximize the distance between calculation
-// of dependent links. This increases the amount of parallelism that can
-// be exploited by out-of-order instruction processors with large but
-// (inevitably) finite instruction windows.
-//
-//===================================================================
-
-// A small structure to track lists of dependent link calculations.
-class LinkDeps {
-public:
-	// A link calculation that is dependent on this one.
-	// Positive values = "input A" while negative values = "input B".
-	int value;
-	// Next dependence in the list.
-	LinkDeps *next;
-};
-typedef LinkDeps *LinkDepsPtr;
-
-void GodotSoftBody3D::reoptimize_link_order() {
-	const int reop_not_dependent = -1;
-	const int reop_node_complete = -2;
-
-	uint32_t link_count = links.size();
-	uint32_t node_count = nodes.size();
+void GodotSoftBody3D::color_links() {
+	link_color_offsets.clear();
 
-	if (link_count < 1 || node_count < 2) {
+	const uint32_t link_count = links.size();
+	if (link_count == 0) {
 		return;
 	}
 
-	uint32_t i;
-	Link *lr;
-	int ar, br;
-	Node *node0 = &(nodes[0]);
-	Node *node1 = &(nodes[1]);
-	LinkDepsPtr link_dep;
-	int ready_list_head, ready_list_tail, link_num, link_dep_frees, dep_link;
-
-	// Allocate temporary buffers.
-	int *node_written_at = memnew_arr(int, node_count + 1); // What link calculation produced this node's current values?
-	int *link_dep_A = memnew_arr(int, link_count); // Link calculation input is dependent upon prior calculation #N
-	int *link_dep_B = memnew_arr(int, link_count);
-	int *ready_list = memnew_arr(int, link_count); // List of ready-to-process link calculations (# of links, maximum)
-	LinkDeps *link_dep_free_list = memnew_arr(LinkDeps, 2 * link_count); // Dependent-on-me list elements (2x# of links, maximum)
-	LinkDepsPtr *link_dep_list_starts = memnew_arr(LinkDepsPtr, link_count); // Start nodes of dependent-on-me lists, one for each link
-
-	// Copy the original, unsorted links to a side buffer.
-	Link *link_buffer = memnew_arr(Link, link_count);
-	memcpy(link_buffer, &(links[0]), sizeof(Link) * link_count);
-
-	// Clear out the node setup and ready list.
-	for (i = 0; i < node_count + 1; i++) {
-		node_written_at[i] = reop_not_dependent;
-	}
-	for (i = 0; i < link_count; i++) {
-		link_dep_list_starts[i] = nullptr;
-	}
-	ready_list_head = ready_list_tail = link_dep_frees = 0;
-
-	// Initial link analysis to set up data structures.
-	for (i = 0; i < link_count; i++) {
-		// Note which prior link calculations we are dependent upon & build up dependence lists.
-		lr = &(links[i]);
-		ar = (lr->n[0] - node0) / (node1 - node0);
-		br = (lr->n[1] - node0) / (node1 - node0);
-		if (node_written_at[ar] > reop_not_dependent) {
-			link_dep_A[i] = node_written_at[ar];
-			link_dep = &link_dep_free_list[link_dep_frees++];
-			link_dep->value = i;
-			link_dep->next = link_dep_list_starts[node_written_at[ar]];
-			link_dep_list_starts[node_written_at[ar]] = link_dep;
-		} else {
-			link_dep_A[i] = reop_not_dependent;
-		}
-		if (node_written_at[br] > reop_not_dependent) {
-			link_dep_B[i] = node_written_at[br];
-			link_dep = &link_dep_free_list[link_dep_frees++];
-			link_dep->value = -(int)(i + 1);
-			link_dep->next = link_dep_list_starts[node_written_at[br]];
-			link_dep_list_starts[node_written_at[br]] = link_dep;
-		} else {
-			link_dep_B[i] = reop_not_dependent;
-		}
+	// Greedy coloring, each link takes the first color that isn't used yet by
+	// another link of one of its nodes.
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, node_colors.size() * sizeof(uint64_t));
+
+	LocalVector<uint32_t> link_colors;
+	link_colors.resize(link_count);
+
+	uint32_t color_count = 0;
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const uint32_t node_a = links[i].n[0]->index;
+		const uint32_t node_b = links[i].n[1]->index;
+		const uint64_t used_colors = node_colors[node_a] | node_colors[node_b];
 
-		// Add this link to the initial ready list, if it is not dependent on any other links.
-		if ((link_dep_A[i] == reop_not_dependent) && (link_dep_B[i] == reop_not_dependent)) {
-			ready_list[ready_list_tail++] = i;
-			link_dep_A[i] = link_dep_B[i] = reop_node_complete; // Probably not needed now.
+		uint32_t color = 0;
+		while (color < MAX_LINK_COLORS && (used_colors & (uint64_t(1) << color))) {
+			++color;
 		}
 
-		// Update the nodes to mark which ones are calculated by this link.
-		node_written_at[ar] = node_written_at[br] = i;
-	}
-
-	// Process the ready list and create the sorted list of links:
-	// -- By treating the ready list as a queue, we maximize the distance between any
-	//    inter-dependent node calculations.
-	// -- All other (non-related) nodes in the ready list will automatically be inserted
-	//    in between each set of inter-dependent link calculations by this loop.
-	i = 0;
-	while (ready_list_head != ready_list_tail) {
-		// Use ready list to select the next link to process.
-		link_num = ready_list[ready_list_head++];
-		// Copy the next-to-calculate link back into the original link array.
-		links[i++] = link_buffer[link_num];
-
-		// Free up any link inputs that are dependent on this one.
-		link_dep = link_dep_list_starts[link_num];
-		while (link_dep) {
-			dep_link = link_dep->value;
-			if (dep_link >= 0) {
-				link_dep_A[dep_link] = reop_not_dependent;
-			} else {
-				dep_link = -dep_link - 1;
-				link_dep_B[dep_link] = reop_not_dependent;
-			}
-			// Add this dependent link calculation to the ready list if *both* inputs are clear.
-			if ((link_dep_A[dep_link] == reop_not_dependent) && (link_dep_B[dep_link] == reop_not_dependent)) {
-				ready_list[ready_list_tail++] = dep_link;
-				link_dep_A[dep_link] = link_dep_B[dep_link] = reop_node_complete; // Probably not needed now.
-			}
-			link_dep = link_dep->next;
+		if (color < MAX_LINK_COLORS) {
+			node_colors[node_a] |= uint64_t(1) << color;
+			node_colors[node_b] |= uint64_t(1) << color;
 		}
+
+		link_colors[i] = color;
+		color_count = MAX(color_count, color + 1);
 	}
 
-	// Delete the temporary buffers.
-	memdelete_arr(node_written_at);
-	memdelete_arr(link_dep_A);
-	memdelete_arr(link_dep_B);
-	memdelete_arr(ready_list);
-	memdelete_arr(link_dep_free_list);
-	memdelete_arr(link_dep_list_starts);
-	memdelete_arr(link_buffer);
+	// Sort links by color, keeping their order inside of each color.
+	link_color_offsets.resize(color_count + 1);
+	memset(link_color_offsets.ptr(), 0, link_color_offsets.size() * sizeof(uint32_t));
+	for (uint32_t i = 0; i < link_count; ++i) {
+		++link_color_offsets[link_colors[i] + 1];
+	}
+	for (uint32_t color = 0; color < color_count; ++color) {
+		link_color_offsets[color + 1] += link_color_offsets[color];
+	}
+
+	LocalVector<uint32_t> color_ends;
+	color_ends.resize(color_count);
+	memcpy(color_ends.ptr(), link_color_offsets.ptr(), color_count * sizeof(uint32_t));
+
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	for (uint32_t i = 0; i < link_count; ++i) {
+		sorted_links[color_ends[link_colors[i]]++] = links[i];
+	}
+	links = sorted_links;
 }
 
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
@@ -1079,8 +1034,8 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node.f = Vector3();
 	}
 
-	// Bounds and tree update.
-	update_bounds();
+	// Bounds and tree update, the shape is updated later in update_shape_bounds().
+	bounds_moved = compute_bounds();
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1101,23 +1056,18 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_parallel_links) {
 	const real_t inv_delta = 1.0 / p_delta;
 
-	for (Link &link : links) {
-		link.c3 = link.n[1]->q - link.n[0]->q;
-		link.c2 = 1 / (link.c3.length_squared() * link.c0);
-	}
-
 	// Solve velocities.
 	for (Node &node : nodes) {
 		node.x = node.q + node.v * p_delta;
 	}
 
 	// Solve positions.
+	const bool parallel_links = p_parallel_links && links.size() >= LINK_PARALLEL_MIN_COUNT;
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
-		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, parallel_links);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (Node &node : nodes) {
@@ -1132,8 +1082,35 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
+void GodotSoftBody3D::solve_links(real_t kst, bool p_parallel) {
+	for (uint32_t color = 0; color + 1 < link_color_offsets.size(); ++color) {
+		const uint32_t begin = link_color_offsets[color];
+		const uint32_t end = link_color_offsets[color + 1];
+
+		if (!p_parallel || color >= MAX_LINK_COLORS || end - begin < LINK_PARALLEL_BATCH_SIZE * 2) {
+			solve_link_range(begin, end, kst);
+			continue;
+		}
+
+		LinkBatch batch;
+		batch.begin = begin;
+		batch.end = end;
+		batch.kst = kst;
+
+		const uint32_t batch_count = (end - begin + LINK_PARALLEL_BATCH_SIZE - 1) / LINK_PARALLEL_BATCH_SIZE;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_batch, (const LinkBatch *)&batch, batch_count, -1, true, SNAME("Physics3DSoftBodySolveLinks"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+}
+
+void GodotSoftBody3D::_solve_link_batch(uint32_t p_index, const LinkBatch *p_batch) {
+	const uint32_t begin = p_batch->begin + p_index * LINK_PARALLEL_BATCH_SIZE;
+	solve_link_range(begin, MIN(begin + LINK_PARALLEL_BATCH_SIZE, p_batch->end), p_batch->kst);
+}
+
+void GodotSoftBody3D::solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst) {
+	for (uint32_t i = p_begin; i < p_end; ++i) {
+		const Link &link = links[i];
 		if (link.c0 > 0) {
 			Node &node_a = *link.n[0];
 			Node &node_b = *link.n[1];
@@ -1255,6 +1232,7 @@ void GodotSoftBody3D::destroy() {
 
 	nodes.clear();
 	links.clear();
+	link_color_offsets.clear();
 	faces.clear();
 
 	bounds = AABB();
@@ -60,12 +60,25 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	};
 
 	struct Link {
-		Vector3 c3; // gradient
 		Node *n[2] = { nullptr, nullptr }; // Node pointers
 		real_t rl = 0.0; // Rest length
 		real_t c0 = 0.0; // (ima+imb)*kLST
 		real_t c1 = 0.0; // rl^2
-		real_t c2 = 0.0; // |gradient|^2/c0
+	};
+
+	// Links are sorted by color, links of the same color don't share any node
+	// and can be solved in parallel. Links which couldn't get one of the colors
+	// are in a last batch, which has to be solved serially. Spreading the links
+	// over threads needs one group task per color and iteration, so it's only
+	// worth it for soft bodies with many links.
+	static const uint32_t MAX_LINK_COLORS = 64;
+	static const uint32_t LINK_PARALLEL_BATCH_SIZE = 256;
+	static const uint32_t LINK_PARALLEL_MIN_COUNT = 8192;
+
+	struct LinkBatch {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		real_t kst = 1.0;
 	};
 
 	struct Face {
@@ -80,6 +93,7 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Node> nodes;
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
+	LocalVector<uint32_t> link_color_offsets;
 
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
@@ -87,6 +101,7 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<uint32_t> map_visual_to_physics;
 
 	AABB bounds;
+	bool bounds_moved = false;
 
 	real_t collision_margin = 0.05;
 
@@ -156,6 +171,7 @@ public:
 	virtual void set_space(GodotSpace3D *p_space) override;
 
 	void set_mesh(RID p_mesh);
+	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 
 	void update_rendering_server(PhysicsServer3DRenderingServerHandler *p_rendering_server_handler);
 
@@ -178,6 +194,11 @@ public:
 	void apply_central_force(const Vector3 &p_force);
 	void apply_node_bias_impulse(uint32_t p_node_index, const Vector3 &p_impulse);
 
+	uint32_t get_link_count() const;
+	void get_link_nodes(uint32_t p_link_index, uint32_t &r_node_1, uint32_t &r_node_2) const;
+	// Returns -1 for links solved serially after all colors.
+	int get_link_color(uint32_t p_link_index) const;
+
 	uint32_t get_face_count() const;
 	void get_face_points(uint32_t p_face_index, Vector3 &r_point_1, Vector3 &r_point_2, Vector3 &r_point_3) const;
 	Vector3 get_face_normal(uint32_t p_face_index) const;
@@ -207,8 +228,11 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
+	// Can run on a thread concurrently with other soft bodies of the space,
+	// update_shape_bounds() must be called afterwards on a single thread.
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void update_shape_bounds();
+	void solve_constraints(real_t p_delta, bool p_parallel_links = false);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -225,6 +249,7 @@ protected:
 
 private:
 	void update_normals_and_centroids();
+	bool compute_bounds();
 	void update_bounds();
 	void update_constants();
 	void update_area();
@@ -237,13 +262,14 @@ private:
 
 	void apply_forces(const LocalVector<GodotArea3D *> &p_wind_areas);
 
-	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
-	void reoptimize_link_order();
+	void color_links();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	void solve_links(real_t kst, bool p_parallel);
+	void solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst);
+	void _solve_link_batch(uint32_t p_index, const LinkBatch *p_batch);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
@@ -617,28 +617,28 @@ GodotPhysicsDirectSpaceState3D::GodotPhysicsDirectSpaceState3D() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
-	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb, GodotCollisionObject3D **r_results, int *r_subindex_results) {
+	int amount = broadphase->cull_aabb(p_aabb, r_results, INTERSECTION_QUERY_MAX, r_subindex_results);
 
 	for (int i = 0; i < amount; i++) {
 		bool keep = true;
 
-		if (intersection_query_results[i] == p_body) {
+		if (r_results[i] == p_body) {
 			keep = false;
-		} else if (intersection_query_results[i]->get_type() == GodotCollisionObject3D::TYPE_AREA) {
+		} else if (r_results[i]->get_type() == GodotCollisionObject3D::TYPE_AREA) {
 			keep = false;
-		} else if (intersection_query_results[i]->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+		} else if (r_results[i]->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
 			keep = false;
-		} else if (!p_body->collides_with(static_cast<GodotBody3D *>(intersection_query_results[i]))) {
+		} else if (!p_body->collides_with(static_cast<GodotBody3D *>(r_results[i]))) {
 			keep = false;
-		} else if (static_cast<GodotBody3D *>(intersection_query_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(intersection_query_results[i]->get_self())) {
+		} else if (static_cast<GodotBody3D *>(r_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(r_results[i]->get_self())) {
 			keep = false;
 		}
 
 		if (!keep) {
 			if (i < amount - 1) {
-				SWAP(intersection_query_results[i], intersection_query_results[amount - 1]);
-				SWAP(intersection_query_subindex_results[i], intersection_query_subindex_results[amount - 1]);
+				SWAP(r_results[i], r_results[amount - 1]);
+				SWAP(r_subindex_results[i], r_subindex_results[amount - 1]);
 			}
 
 			amount--;
@@ -689,6 +689,11 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 
 	real_t margin = MAX(p_parameters.margin, TEST_MOTION_MARGIN_MIN_VALUE);
 
+	// Broadphase results live on the stack rather than in the space, so that
+	// motion tests can run concurrently (see body_test_motion_batch()).
+	GodotCollisionObject3D *query_results[INTERSECTION_QUERY_MAX];
+	int query_subindex_results[INTERSECTION_QUERY_MAX];
+
 	// Undo the currently transform the physics server is aware of and apply the provided one
 	body_aabb = p_parameters.from.xform(p_body->get_inv_transform().xform(body_aabb));
 	body_aabb = body_aabb.grow(margin);
@@ -722,7 +727,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 
 			bool collided = false;
 
-			int amount = _cull_aabb_for_body(p_body, body_aabb);
+			int amount = _cull_aabb_for_body(p_body, body_aabb, query_results, query_subindex_results);
 
 			for (int j = 0; j < p_body->get_shape_count(); j++) {
 				if (p_body->is_shape_disabled(j)) {
@@ -733,7 +738,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 				GodotShape3D *body_shape = p_body->get_shape(j);
 
 				for (int i = 0; i < amount; i++) {
-					const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+					const GodotCollisionObject3D *col_obj = query_results[i];
 					if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 						continue;
 					}
@@ -741,7 +746,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 						continue;
 					}
 
-					int shape_idx = intersection_query_subindex_results[i];
+					int shape_idx = query_subindex_results[i];
 
 					if (GodotCollisionSolver3D::solve_static(body_shape, body_shape_xform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), cbkres, cbkptr, nullptr, margin)) {
 						collided = cbk.amount > 0;
@@ -806,7 +811,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		motion_aabb.position += p_parameters.motion;
 		motion_aabb = motion_aabb.merge(body_aabb);
 
-		int amount = _cull_aabb_for_body(p_body, motion_aabb);
+		int amount = _cull_aabb_for_body(p_body, motion_aabb, query_results, query_subindex_results);
 
 		for (int j = 0; j < p_body->get_shape_count(); j++) {
 			if (p_body->is_shape_disabled(j)) {
@@ -837,7 +842,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			real_t best_unsafe = 1;
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -845,7 +850,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = query_subindex_results[i];
 
 				//test initial overlap, does it collide if going all the way?
 				Vector3 point_A, point_B;
@@ -946,7 +951,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		rcd.min_allowed_depth = MIN(motion_length, min_contact_depth);
 
 		body_aabb.position += p_parameters.motion * unsafe;
-		int amount = _cull_aabb_for_body(p_body, body_aabb);
+		int amount = _cull_aabb_for_body(p_body, body_aabb, query_results, query_subindex_results);
 
 		int from_shape = best_shape != -1 ? best_shape : 0;
 		int to_shape = best_shape != -1 ? best_shape + 1 : p_body->get_shape_count();
@@ -960,7 +965,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			GodotShape3D *body_shape = p_body->get_shape(j);
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -968,7 +973,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = query_subindex_results[i];
 
 				rcd.object = col_obj;
 				rcd.shape = shape_idx;
@@ -1030,6 +1035,297 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 	return collided;
 }
 
+struct MotionBatchBounds {
+	AABB aabb;
+	int item = 0;
+};
+
+struct MotionBatchBoundsSort {
+	_FORCE_INLINE_ bool operator()(const MotionBatchBounds &p_a, const MotionBatchBounds &p_b) const {
+		return p_a.aabb.position.x < p_b.aabb.position.x;
+	}
+};
+
+void GodotSpace3D::resolve_body_motion_batch(PhysicsServer3D::MotionBatchItem *p_items, GodotBody3D *const *p_bodies, int p_item_count) {
+	enum {
+		OVERLAPS_EARLIER = 1,
+		OVERLAPS_LATER = 2,
+	};
+
+	// Every item was tested against the space as it was before the batch. Gather the swept
+	// bounds of the items in this space, to find the bodies that may have moved into each other.
+	LocalVector<MotionBatchBounds> bounds;
+	for (int i = 0; i < p_item_count; i++) {
+		GodotBody3D *body = p_bodies[i];
+		if (body == nullptr || body->get_space() != this) {
+			continue;
+		}
+
+		AABB body_aabb;
+		bool shapes_found = false;
+		for (int j = 0; j < body->get_shape_count(); j++) {
+			if (body->is_shape_disabled(j)) {
+				continue;
+			}
+
+			if (!shapes_found) {
+				body_aabb = body->get_shape_aabb(j);
+				shapes_found = true;
+			} else {
+				body_aabb = body_aabb.merge(body->get_shape_aabb(j));
+			}
+		}
+
+		if (!shapes_found) {
+			continue;
+		}
+
+		const PhysicsServer3D::MotionBatchItem &item = p_items[i];
+		real_t margin = MAX(item.parameters.margin, TEST_MOTION_MARGIN_MIN_VALUE);
+		body_aabb = item.parameters.from.xform(body->get_inv_transform().xform(body_aabb)).grow(margin);
+
+		MotionBatchBounds entry;
+		entry.aabb = body_aabb.merge(AABB(body_aabb.position + item.result.travel, body_aabb.size));
+		entry.item = i;
+		bounds.push_back(entry);
+	}
+
+	if (bounds.size() < 2) {
+		return;
+	}
+
+	// Sort and sweep along X to find overlapping pairs.
+	bounds.sort_custom<MotionBatchBoundsSort>();
+
+	LocalVector<uint8_t> overlap_flags;
+	overlap_flags.resize(p_item_count);
+	memset(overlap_flags.ptr(), 0, p_item_count);
+
+	bool any_overlap = false;
+	for (uint32_t i = 0; i < bounds.size(); i++) {
+		const MotionBatchBounds &a = bounds[i];
+		real_t end_x = a.aabb.position.x + a.aabb.size.x;
+
+		for (uint32_t j = i + 1; j < bounds.size() && bounds[j].aabb.position.x <= end_x; j++) {
+			const MotionBatchBounds &b = bounds[j];
+			if (!a.aabb.intersects(b.aabb)) {
+				continue;
+			}
+
+			GodotBody3D *body_a = p_bodies[a.item];
+			GodotBody3D *body_b = p_bodies[b.item];
+			if (body_a == body_b || (!body_a->collides_with(body_b) && !body_b->collides_with(body_a))) {
+				continue;
+			}
+
+			overlap_flags[MIN(a.item, b.item)] |= OVERLAPS_LATER;
+			overlap_flags[MAX(a.item, b.item)] |= OVERLAPS_EARLIER;
+			any_overlap = true;
+		}
+	}
+
+	if (!any_overlap) {
+		return;
+	}
+
+	// In array order, test again the items that overlap an earlier one, once every earlier
+	// item has been placed at the end of its motion. Later items stay where they were, so
+	// the outcome only depends on the order of the items.
+	LocalVector<GodotBody3D *> placed_bodies;
+	LocalVector<Transform3D> placed_transforms;
+
+	for (int i = 0; i < p_item_count; i++) {
+		if (!overlap_flags[i]) {
+			continue;
+		}
+
+		GodotBody3D *body = p_bodies[i];
+		PhysicsServer3D::MotionBatchItem &item = p_items[i];
+
+		if (overlap_flags[i] & OVERLAPS_EARLIER) {
+			item.collided = test_body_motion(body, item.parameters, &item.result);
+		}
+
+		if (overlap_flags[i] & OVERLAPS_LATER) {
+			placed_bodies.push_back(body);
+			placed_transforms.push_back(body->get_transform());
+
+			Transform3D resolved = item.parameters.from;
+			resolved.origin += item.result.travel;
+			body->set_motion_test_transform(resolved);
+		}
+	}
+
+	for (int i = int(placed_bodies.size()) - 1; i >= 0; i--) {
+		placed_bodies[i]->set_motion_test_transform(placed_transforms[i]);
+	}
+}
+
+// Snapshots are laid out as a fixed header followed by packed arrays of body states and contact
+// manifolds, so that both capturing and restoring amount to bulk copies of plain data.
+static constexpr uint32_t SPACE_SNAPSHOT_MAGIC = 0x33535350; // "PSS3"
+static constexpr uint32_t SPACE_SNAPSHOT_VERSION = 1;
+
+struct SpaceSnapshotHeader {
+	uint32_t magic = SPACE_SNAPSHOT_MAGIC;
+	uint32_t version = SPACE_SNAPSHOT_VERSION;
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+	uint32_t reserved = 0;
+};
+
+struct SpaceSnapshotPairKey {
+	uint64_t body_A = 0;
+	uint64_t body_B = 0;
+	int32_t shape_A = 0;
+	int32_t shape_B = 0;
+
+	static uint32_t hash(const SpaceSnapshotPairKey &p_key) {
+		uint32_t h = hash_murmur3_one_64(p_key.body_A);
+		h = hash_murmur3_one_64(p_key.body_B, h);
+		h = hash_murmur3_one_32(p_key.shape_A, h);
+		h = hash_murmur3_one_32(p_key.shape_B, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const SpaceSnapshotPairKey &p_other) const {
+		return body_A == p_other.body_A && body_B == p_other.body_B && shape_A == p_other.shape_A && shape_B == p_other.shape_B;
+	}
+};
+
+PackedByteArray GodotSpace3D::create_snapshot() const {
+	ERR_FAIL_COND_V_MSG(locked, PackedByteArray(), "Can't create a snapshot of a space while it is being stepped or queried.");
+
+	SpaceSnapshotHeader header;
+
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			header.body_count++;
+		}
+	}
+
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		if (E->self()->has_contacts()) {
+			header.pair_count++;
+		}
+	}
+
+	PackedByteArray snapshot;
+	snapshot.resize(sizeof(SpaceSnapshotHeader) + header.body_count * sizeof(GodotBody3D::SnapshotState) + header.pair_count * sizeof(GodotBodyPair3D::SnapshotState));
+	uint8_t *w = snapshot.ptrw();
+
+	memcpy(w, &header, sizeof(SpaceSnapshotHeader));
+	w += sizeof(SpaceSnapshotHeader);
+
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+
+		// Zeroed first so padding bytes don't make snapshots of the same state differ.
+		GodotBody3D::SnapshotState state;
+		memset(static_cast<void *>(&state), 0, sizeof(GodotBody3D::SnapshotState));
+		static_cast<const GodotBody3D *>(E)->get_snapshot_state(state);
+		memcpy(w, &state, sizeof(GodotBody3D::SnapshotState));
+		w += sizeof(GodotBody3D::SnapshotState);
+	}
+
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		const GodotBodyPair3D *pair = E->self();
+		if (!pair->has_contacts()) {
+			continue;
+		}
+
+		GodotBodyPair3D::SnapshotState state;
+		memset(static_cast<void *>(&state), 0, sizeof(GodotBodyPair3D::SnapshotState));
+		pair->get_snapshot_state(state);
+		memcpy(w, &state, sizeof(GodotBodyPair3D::SnapshotState));
+		w += sizeof(GodotBodyPair3D::SnapshotState);
+	}
+
+	return snapshot;
+}
+
+bool GodotSpace3D::restore_snapshot(const PackedByteArray &p_snapshot) {
+	ERR_FAIL_COND_V_MSG(locked, false, "Can't restore a snapshot of a space while it is being stepped or queried.");
+	ERR_FAIL_COND_V_MSG(p_snapshot.size() < (int64_t)sizeof(SpaceSnapshotHeader), false, "Invalid physics space snapshot.");
+
+	const uint8_t *r = p_snapshot.ptr();
+
+	SpaceSnapshotHeader header;
+	memcpy(&header, r, sizeof(SpaceSnapshotHeader));
+	r += sizeof(SpaceSnapshotHeader);
+
+	ERR_FAIL_COND_V_MSG(header.magic != SPACE_SNAPSHOT_MAGIC, false, "Invalid physics space snapshot.");
+	ERR_FAIL_COND_V_MSG(header.version != SPACE_SNAPSHOT_VERSION, false, vformat("Unsupported physics space snapshot version %d.", header.version));
+	ERR_FAIL_COND_V_MSG(header.real_size != sizeof(real_t), false, "Physics space snapshot was created with a different floating-point precision.");
+
+	const uint64_t expected_size = sizeof(SpaceSnapshotHeader) + uint64_t(header.body_count) * sizeof(GodotBody3D::SnapshotState) + uint64_t(header.pair_count) * sizeof(GodotBodyPair3D::SnapshotState);
+	ERR_FAIL_COND_V_MSG(uint64_t(p_snapshot.size()) != expected_size, false, "Physics space snapshot is truncated or corrupted.");
+
+	HashMap<uint64_t, GodotBody3D *> bodies;
+	bodies.reserve(objects.size());
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	// Bodies that were removed from the space since the snapshot was taken are skipped.
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotBody3D::SnapshotState state;
+		memcpy(&state, r, sizeof(GodotBody3D::SnapshotState));
+		r += sizeof(GodotBody3D::SnapshotState);
+
+		GodotBody3D **body = bodies.getptr(state.rid);
+		if (body) {
+			(*body)->set_snapshot_state(state);
+		}
+	}
+
+	// Let the broadphase create the pairs for the restored transforms, so their manifolds can be restored below.
+	broadphase->update();
+
+	LocalVector<GodotBodyPair3D::SnapshotState> states;
+	states.resize(header.pair_count);
+	if (header.pair_count > 0) {
+		memcpy(states.ptr(), r, header.pair_count * sizeof(GodotBodyPair3D::SnapshotState));
+	}
+
+	HashMap<SpaceSnapshotPairKey, const GodotBodyPair3D::SnapshotState *, SpaceSnapshotPairKey> pair_states;
+	pair_states.reserve(header.pair_count);
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		SpaceSnapshotPairKey key;
+		key.body_A = states[i].body_A;
+		key.body_B = states[i].body_B;
+		key.shape_A = states[i].shape_A;
+		key.shape_B = states[i].shape_B;
+		pair_states.insert(key, &states[i]);
+	}
+
+	// Pairs that had no contacts when the snapshot was taken are reset, so resimulation starts from the same manifolds.
+	const GodotBodyPair3D::SnapshotState empty_state;
+	for (SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		GodotBodyPair3D *pair = E->self();
+
+		SpaceSnapshotPairKey key;
+		key.body_A = pair->get_body_A()->get_self().get_id();
+		key.body_B = pair->get_body_B()->get_self().get_id();
+		key.shape_A = pair->get_shape_A();
+		key.shape_B = pair->get_shape_B();
+
+		const GodotBodyPair3D::SnapshotState **state = pair_states.getptr(key);
+		if (state) {
+			pair->set_snapshot_state(**state);
+		} else {
+			pair->set_snapshot_state(empty_state);
+		}
+	}
+
+	return true;
+}
+
 // Assumes a valid collision pair, this should have been checked beforehand in the BVH or octree.
 void *GodotSpace3D::_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self) {
 	GodotCollisionObject3D::Type type_A = A->get_type();
@@ -1163,6 +1459,10 @@ void GodotSpace3D::soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *
 	active_soft_body_list.remove(p_soft_body);
 }
 
+void GodotSpace3D::body_pair_add_to_list(SelfList<GodotBodyPair3D> *p_pair) {
+	body_pair_list.add(p_pair);
+}
+
 void GodotSpace3D::call_queries() {
 	while (state_query_list.first()) {
 		GodotBody3D *b = state_query_list.first()->self();
@@ -182,6 +182,14 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->predict_motion(delta);
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -212,13 +220,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	soft_bodies.clear();
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->predict_motion(p_delta);
+		soft_bodies.push_back(sb->self());
 		sb = sb->next();
 		active_count++;
 	}
 
+	if (!soft_bodies.is_empty()) {
+		WorkerThreadPool::GroupID soft_body_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_predict_soft_body_motion, nullptr, soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(soft_body_task);
+
+		// WARNING: This doesn't run on threads, because it moves the shapes in the broadphase.
+		for (GodotSoftBody3D *soft_body : soft_bodies) {
+			soft_body->update_shape_bounds();
+		}
+	}
+
 	p_space->set_active_objects(active_count);
 
 	// Update the broadphase to register collision pairs.
@@ -390,10 +409,12 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
+	if (soft_bodies.size() == 1) {
+		// A single soft body is solved on this thread, spreading its links over threads instead.
+		soft_bodies[0]->solve_constraints(p_delta, true);
+	} else if (soft_bodies.size() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 	}
 
 	{ //profile
@@ -403,6 +424,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	soft_bodies.clear();
 
 	p_space->unlock();
 	_step++;
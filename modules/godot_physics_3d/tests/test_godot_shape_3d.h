@@ -0,0 +1,293 @@
+/**************************************************************************/
+/*  test_godot_shape_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_shape_3d.h"
+
+#include "core/math/random_number_generator.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotShape3D {
+
+static Vector<Vector3> _random_point_cloud(int p_count, uint64_t p_seed) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+
+	Vector<Vector3> points;
+	for (int i = 0; i < p_count; i++) {
+		points.push_back(Vector3(rng->randf_range(-1.0, 1.0), rng->randf_range(-2.0, 2.0), rng->randf_range(-0.5, 0.5)));
+	}
+	return points;
+}
+
+TEST_CASE("[GodotPhysics3D][ConvexPolygonShape3D] Support mapping matches a brute-force scan") {
+	// Covers meshes scanned in SoA blocks as well as meshes large enough to use the neighbor walk.
+	const int point_counts[] = { 4, 13, 64, 1000 };
+
+	for (int point_count : point_counts) {
+		GodotConvexPolygonShape3D shape;
+		shape.set_data(_random_point_cloud(point_count, point_count));
+
+		const Geometry3D::MeshData &mesh = shape.get_mesh();
+		REQUIRE(mesh.vertices.size() > 0);
+
+		const Transform3D transform(Basis(Vector3(0.3, 1.0, -0.2).normalized(), 0.7).scaled(Vector3(1.0, 2.0, 0.5)), Vector3(3.0, -1.0, 2.0));
+		const Vector<Vector3> directions = _random_point_cloud(32, 1234);
+
+		for (Vector3 direction : directions) {
+			direction.normalize();
+
+			real_t expected_support = -Math::INF;
+			real_t expected_min = Math::INF;
+			real_t expected_max = -Math::INF;
+			for (const Vector3 &vertex : mesh.vertices) {
+				expected_support = MAX(expected_support, direction.dot(vertex));
+				real_t d = direction.dot(transform.xform(vertex));
+				expected_min = MIN(expected_min, d);
+				expected_max = MAX(expected_max, d);
+			}
+
+			CHECK(Math::is_equal_approx(direction.dot(shape.get_support(direction)), expected_support));
+
+			real_t min = 0.0;
+			real_t max = 0.0;
+			shape.project_range(direction, transform, min, max);
+			CHECK(Math::is_equal_approx(min, expected_min, (real_t)0.0001));
+			CHECK(Math::is_equal_approx(max, expected_max, (real_t)0.0001));
+		}
+	}
+}
+
+static Vector<Vector3> _random_triangle_soup(int p_count, uint64_t p_seed) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+
+	Vector<Vector3> faces;
+	for (int i = 0; i < p_count; i++) {
+		const Vector3 center(rng->randf_range(-10.0, 10.0), rng->randf_range(-10.0, 10.0), rng->randf_range(-10.0, 10.0));
+		for (int j = 0; j < 3; j++) {
+			faces.push_back(center + Vector3(rng->randf_range(-1.0, 1.0), rng->randf_range(-1.0, 1.0), rng->randf_range(-1.0, 1.0)));
+		}
+	}
+	return faces;
+}
+
+static bool _count_culled_face(void *p_userdata, GodotShape3D *p_face) {
+	Pair<AABB, int> *query = static_cast<Pair<AABB, int> *>(p_userdata);
+	const GodotFaceShape3D *face = static_cast<GodotFaceShape3D *>(p_face);
+	if (Face3(face->vertex[0], face->vertex[1], face->vertex[2]).get_aabb().intersects(query->first)) {
+		query->second++;
+	}
+	return false;
+}
+
+TEST_CASE("[GodotPhysics3D][ConcavePolygonShape3D] BVH queries match a brute-force scan") {
+	const Vector<Vector3> source_faces = _random_triangle_soup(2000, 42);
+
+	GodotConcavePolygonShape3D shape;
+	Dictionary data;
+	data["faces"] = source_faces;
+	data["backface_collision"] = false;
+	shape.set_data(data);
+
+	// Faces are reordered internally, but must come back in their original order.
+	CHECK(shape.get_faces() == source_faces);
+
+	const int face_count = source_faces.size() / 3;
+	const Vector<Vector3> points = _random_point_cloud(64, 7);
+
+	for (int i = 0; i + 1 < points.size(); i += 2) {
+		const Vector3 from = points[i] * 12.0;
+		const Vector3 to = points[i + 1] * -12.0;
+		const Vector3 dir = (to - from).normalized();
+
+		real_t expected_d = 1e20;
+		int expected_face = -1;
+		for (int j = 0; j < face_count; j++) {
+			GodotFaceShape3D face;
+			face.vertex[0] = source_faces[j * 3 + 0];
+			face.vertex[1] = source_faces[j * 3 + 1];
+			face.vertex[2] = source_faces[j * 3 + 2];
+			face.normal = Face3(face.vertex[0], face.vertex[1], face.vertex[2]).get_plane().normal;
+
+			Vector3 result;
+			Vector3 normal;
+			int face_index = j;
+			if (face.intersect_segment(from, to, result, normal, face_index, true)) {
+				real_t d = dir.dot(result - from);
+				if (d > 0 && d < expected_d) {
+					expected_d = d;
+					expected_face = j;
+				}
+			}
+		}
+
+		Vector3 result;
+		Vector3 normal;
+		int face_index = -1;
+		const bool hit = shape.intersect_segment(from, to, result, normal, face_index, false);
+
+		CHECK(hit == (expected_face >= 0));
+		if (hit) {
+			CHECK(face_index == expected_face);
+			CHECK(Math::is_equal_approx(dir.dot(result - from), expected_d, (real_t)0.0001));
+		}
+
+		// Every face overlapping the query box must be reported once.
+		const AABB query = AABB(points[i] * 8.0, Vector3(3.0, 3.0, 3.0));
+		int expected_count = 0;
+		for (int j = 0; j < face_count; j++) {
+			if (Face3(source_faces[j * 3 + 0], source_faces[j * 3 + 1], source_faces[j * 3 + 2]).get_aabb().intersects(query)) {
+				expected_count++;
+			}
+		}
+
+		Pair<AABB, int> culled(query, 0);
+		shape.cull(query, _count_culled_face, &culled, false);
+		CHECK(culled.second == expected_count);
+	}
+}
+
+static Dictionary _random_height_map_data(int p_width, int p_depth, uint64_t p_seed) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+
+	Vector<real_t> heights;
+	heights.resize(p_width * p_depth);
+	for (int z = 0; z < p_depth; z++) {
+		for (int x = 0; x < p_width; x++) {
+			heights.write[z * p_width + x] = Math::sin(x * 0.2) * 4.0 + Math::cos(z * 0.15) * 3.0 + rng->randf_range(-0.5, 0.5);
+		}
+	}
+
+	Dictionary data;
+	data["width"] = p_width;
+	data["depth"] = p_depth;
+	data["heights"] = heights;
+	return data;
+}
+
+TEST_CASE("[GodotPhysics3D][HeightMapShape3D] Long rays and region updates match the cell march") {
+	const int width = 100;
+	const int depth = 77;
+	const Dictionary source_data = _random_height_map_data(width, depth, 3);
+
+	GodotHeightMapShape3D shape;
+	shape.set_data(source_data);
+
+	// Start flat and write the same heights in two regions, which must result in the same shape.
+	GodotHeightMapShape3D updated_shape;
+	{
+		Dictionary data;
+		data["width"] = width;
+		data["depth"] = depth;
+		Vector<real_t> flat;
+		flat.resize(width * depth);
+		flat.fill(0.0);
+		data["heights"] = flat;
+		updated_shape.set_data(data);
+
+		const Vector<real_t> source_heights = source_data["heights"];
+		const Rect2i regions[] = { Rect2i(0, 0, width, 40), Rect2i(0, 40, width, depth - 40) };
+		for (const Rect2i &region : regions) {
+			Vector<real_t> region_heights;
+			for (int z = region.position.y; z < region.get_end().y; z++) {
+				for (int x = region.position.x; x < region.get_end().x; x++) {
+					region_heights.push_back(source_heights[z * width + x]);
+				}
+			}
+
+			Dictionary region_data;
+			region_data["width"] = width;
+			region_data["depth"] = depth;
+			region_data["region"] = region;
+			region_data["heights"] = region_heights;
+			updated_shape.set_data(region_data);
+		}
+
+		CHECK(updated_shape.get_heights() == source_heights);
+		CHECK(updated_shape.get_aabb().is_equal_approx(shape.get_aabb()));
+	}
+
+	const Vector<Vector3> points = _random_point_cloud(64, 11);
+	for (int i = 0; i + 1 < points.size(); i += 2) {
+		const Vector3 from = Vector3(points[i].x * 60.0, 12.0 + points[i].y, points[i].z * 90.0);
+		const Vector3 to = Vector3(points[i + 1].x * -60.0, -12.0 + points[i + 1].y, points[i + 1].z * -90.0);
+
+		// Reference result, from segments short enough to march the cells directly.
+		bool expected_hit = false;
+		Vector3 expected_point;
+		const int steps = 64;
+		for (int j = 0; j < steps && !expected_hit; j++) {
+			Vector3 normal;
+			int face_index = -1;
+			expected_hit = shape.intersect_segment(from.lerp(to, real_t(j) / steps), from.lerp(to, real_t(j + 1) / steps), expected_point, normal, face_index, true);
+		}
+
+		for (const GodotHeightMapShape3D *tested_shape : { &shape, &updated_shape }) {
+			Vector3 point;
+			Vector3 normal;
+			int face_index = -1;
+			const bool hit = tested_shape->intersect_segment(from, to, point, normal, face_index, true);
+
+			CHECK(hit == expected_hit);
+			if (hit && expected_hit) {
+				CHECK(point.is_equal_approx(expected_point));
+			}
+		}
+	}
+}
+
+TEST_CASE("[GodotPhysics3D][HeightMapShape3D] Half precision storage") {
+	Dictionary data = _random_height_map_data(40, 40, 5);
+	data["half_precision"] = true;
+
+	GodotHeightMapShape3D shape;
+	shape.set_data(data);
+
+	const Vector<real_t> source_heights = data["heights"];
+	const Vector<real_t> heights = shape.get_heights();
+	REQUIRE(heights.size() == source_heights.size());
+	for (int i = 0; i < heights.size(); i++) {
+		CHECK(Math::is_equal_approx(heights[i], source_heights[i], (real_t)0.01));
+		CHECK(heights[i] >= shape.get_aabb().position.y);
+		CHECK(heights[i] <= shape.get_aabb().get_end().y);
+	}
+
+	const Dictionary shape_data = shape.get_data();
+	CHECK(bool(shape_data["half_precision"]));
+}
+
+} // namespace TestGodotShape3D
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_godot_soft_body_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_soft_body_3d.h"
+
+#include "core/templates/hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSoftBody3D {
+
+static void _create_cloth(GodotSoftBody3D &r_soft_body, int p_size) {
+	Vector<Vector3> vertices;
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			vertices.push_back(Vector3(x * 0.1, 0.0, z * 0.1));
+		}
+	}
+
+	Vector<int> indices;
+	for (int z = 0; z + 1 < p_size; z++) {
+		for (int x = 0; x + 1 < p_size; x++) {
+			const int i = z * p_size + x;
+			indices.push_back(i);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 1);
+			indices.push_back(i + p_size);
+		}
+	}
+
+	REQUIRE(r_soft_body.create_from_trimesh(indices, vertices));
+}
+
+TEST_CASE("[GodotPhysics3D][SoftBody3D] Links of the same color share no node") {
+	GodotSoftBody3D soft_body;
+	_create_cloth(soft_body, 16);
+
+	HashMap<int, LocalVector<uint32_t>> nodes_per_color;
+	int previous_color = 0;
+	for (uint32_t i = 0; i < soft_body.get_link_count(); i++) {
+		const int color = soft_body.get_link_color(i);
+		if (color < 0) {
+			continue;
+		}
+		// Links are sorted by color.
+		CHECK(color >= previous_color);
+		previous_color = color;
+
+		uint32_t node_1 = 0;
+		uint32_t node_2 = 0;
+		soft_body.get_link_nodes(i, node_1, node_2);
+		LocalVector<uint32_t> &color_nodes = nodes_per_color[color];
+		CHECK_FALSE(color_nodes.has(node_1));
+		CHECK_FALSE(color_nodes.has(node_2));
+		color_nodes.push_back(node_1);
+		color_nodes.push_back(node_2);
+	}
+	CHECK(nodes_per_color.size() > 1);
+}
+
+TEST_CASE("[GodotPhysics3D][SoftBody3D] Solving links in parallel matches solving them serially") {
+	// Large enough to spread the links over threads.
+	GodotSoftBody3D serial_soft_body;
+	GodotSoftBody3D parallel_soft_body;
+	_create_cloth(serial_soft_body, 48);
+	_create_cloth(parallel_soft_body, 48);
+	REQUIRE(serial_soft_body.get_link_count() > 8192);
+
+	for (uint32_t i = 0; i < serial_soft_body.get_node_count(); i += 7) {
+		const Vector3 impulse((i % 5) * 0.01, 0.1, (i % 3) * -0.02);
+		serial_soft_body.apply_node_impulse(i, impulse);
+		parallel_soft_body.apply_node_impulse(i, impulse);
+	}
+
+	for (int step = 0; step < 4; step++) {
+		serial_soft_body.solve_constraints(1.0 / 60.0, false);
+		parallel_soft_body.solve_constraints(1.0 / 60.0, true);
+	}
+
+	// Links of one color never touch the same node, so the order they're solved in doesn't matter.
+	bool equal = true;
+	for (uint32_t i = 0; i < serial_soft_body.get_node_count(); i++) {
+		equal = equal && serial_soft_body.get_node_position(i) == parallel_soft_body.get_node_position(i);
+	}
+	CHECK(equal);
+}
+
+} // namespace TestGodotSoftBody3D
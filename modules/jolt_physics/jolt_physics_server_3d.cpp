@@ -267,6 +267,20 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+PackedByteArray JoltPhysicsServer3D::space_create_snapshot(RID p_space) const {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+
+	return space->create_snapshot();
+}
+
+bool JoltPhysicsServer3D::space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+
+	return space->restore_snapshot(p_snapshot);
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  jolt_state_recorder.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/variant/variant.h"
+
+#include "Jolt/Jolt.h"
+
+#include "Jolt/Physics/StateRecorder.h"
+
+class JoltStateRecorder final : public JPH::StateRecorder {
+	PackedByteArray data;
+	int64_t read_position = 0;
+	bool failed = false;
+
+public:
+	JoltStateRecorder() = default;
+	explicit JoltStateRecorder(const PackedByteArray &p_data) :
+			data(p_data) {}
+
+	const PackedByteArray &get_data() const { return data; }
+
+	virtual void WriteBytes(const void *p_data, size_t p_bytes) override {
+		const int64_t offset = data.size();
+		if (data.resize(offset + (int64_t)p_bytes) != OK) {
+			failed = true;
+			return;
+		}
+		memcpy(data.ptrw() + offset, p_data, p_bytes);
+	}
+
+	virtual void ReadBytes(void *p_data, size_t p_bytes) override {
+		if (read_position + (int64_t)p_bytes > data.size()) {
+			failed = true;
+			memset(p_data, 0, p_bytes);
+			return;
+		}
+		memcpy(p_data, data.ptr() + read_position, p_bytes);
+		read_position += p_bytes;
+	}
+
+	virtual bool IsEOF() const override {
+		return read_position >= data.size();
+	}
+
+	virtual bool IsFailed() const override {
+		return failed;
+	}
+};
@@ -105,7 +105,13 @@ JPH::ShapeRefC JoltHeightMapShape3D::_build_height_field() const {
 
 	JPH::HeightFieldShapeSettings shape_settings(heights_rev.ptr(), JPH::Vec3(offset_x, 0, offset_y), JPH::Vec3::sOne(), (JPH::uint32)width);
 
-	shape_settings.mBitsPerSample = shape_settings.CalculateBitsPerSampleForError(0.0f);
+	float max_error = 0.0f;
+	if (half_precision) {
+		// Allow the same error as a half-precision float has at the largest height, which lets Jolt use fewer bits per sample.
+		max_error = (float)MAX(Math::abs(aabb.position.y), Math::abs(aabb.get_end().y)) / 2048.0f;
+	}
+
+	shape_settings.mBitsPerSample = shape_settings.CalculateBitsPerSampleForError(max_error);
 	shape_settings.mActiveEdgeCosThresholdAngle = JoltProjectSettings::active_edge_threshold_cos;
 
 	const JPH::ShapeSettings::ShapeResult shape_result = shape_settings.Create();
@@ -197,9 +203,40 @@ Variant JoltHeightMapShape3D::get_data() const {
 	data["width"] = width;
 	data["depth"] = depth;
 	data["heights"] = heights;
+	data["half_precision"] = half_precision;
 	return data;
 }
 
+void JoltHeightMapShape3D::_update_region(const Rect2i &p_region, const Variant &p_heights) {
+#ifdef REAL_T_IS_DOUBLE
+	const PackedFloat64Array region_heights = p_heights;
+#else
+	const PackedFloat32Array region_heights = p_heights;
+#endif
+
+	ERR_FAIL_COND(p_region.size.x <= 0 || p_region.size.y <= 0);
+	ERR_FAIL_COND(p_region.position.x < 0 || p_region.position.y < 0 || p_region.get_end().x > width || p_region.get_end().y > depth);
+	ERR_FAIL_COND(region_heights.size() != p_region.size.x * p_region.size.y);
+
+	real_t *heights_ptr = heights.ptrw();
+	const real_t *region_ptr = region_heights.ptr();
+
+	for (int z = 0; z < p_region.size.y; ++z) {
+		memcpy(heights_ptr + ptrdiff_t((p_region.position.y + z) * width + p_region.position.x), region_ptr + ptrdiff_t(z * p_region.size.x), p_region.size.x * sizeof(real_t));
+	}
+
+	// The AABB only grows here, which is conservative but avoids scanning the whole map.
+	for (int i = 0; i < region_heights.size(); ++i) {
+		const real_t height = region_ptr[i];
+		if (height < aabb.position.y) {
+			aabb.size.y += aabb.position.y - height;
+			aabb.position.y = height;
+		} else if (height > aabb.get_end().y) {
+			aabb.size.y = height - aabb.position.y;
+		}
+	}
+}
+
 void JoltHeightMapShape3D::set_data(const Variant &p_data) {
 	ERR_FAIL_COND(p_data.get_type() != Variant::DICTIONARY);
 
@@ -219,9 +256,21 @@ void JoltHeightMapShape3D::set_data(const Variant &p_data) {
 	const Variant maybe_depth = data.get("depth", Variant());
 	ERR_FAIL_COND(maybe_depth.get_type() != Variant::INT);
 
+	const Variant maybe_region = data.get("region", Variant());
+	if (maybe_region.get_type() == Variant::RECT2I) {
+		// Jolt shapes are immutable, so the shape still has to be rebuilt, but the full heights don't need to be copied.
+		ERR_FAIL_COND_MSG((int)maybe_width != width || (int)maybe_depth != depth, "Height map region updates can't change the size of the map.");
+
+		_update_region(maybe_region, maybe_heights);
+
+		destroy();
+		return;
+	}
+
 	heights = maybe_heights;
 	width = maybe_width;
 	depth = maybe_depth;
+	half_precision = data.get("half_precision", false);
 
 	aabb = _calculate_aabb();
 
@@ -44,11 +44,14 @@ class JoltHeightMapShape3D final : public JoltShape3D {
 	int width = 0;
 	int depth = 0;
 
+	bool half_precision = false;
+
 	virtual JPH::ShapeRefC _build() const override;
 	JPH::ShapeRefC _build_height_field() const;
 	JPH::ShapeRefC _build_mesh() const;
 
 	AABB _calculate_aabb() const;
+	void _update_region(const Rect2i &p_region, const Variant &p_heights);
 
 public:
 	virtual ShapeType get_type() const override { return ShapeType::SHAPE_HEIGHTMAP; }
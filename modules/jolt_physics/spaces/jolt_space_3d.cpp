@@ -33,6 +33,7 @@
 #include "../joints/jolt_joint_3d.h"
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
+#include "../misc/jolt_state_recorder.h"
 #include "../misc/jolt_stream_wrappers.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
@@ -562,6 +563,32 @@ void JoltSpace3D::remove_joint(JoltJoint3D *p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+PackedByteArray JoltSpace3D::create_snapshot() {
+	ERR_FAIL_COND_V_MSG(stepping, PackedByteArray(), vformat("Can't create a snapshot of physics space with RID '%d' while it is being stepped.", rid.get_id()));
+
+	flush_pending_objects();
+
+	// Saving everything includes the contact cache, which carries the warm-start impulses.
+	JoltStateRecorder recorder;
+	physics_system->SaveState(recorder, JPH::EStateRecorderState::All);
+	ERR_FAIL_COND_V_MSG(recorder.IsFailed(), PackedByteArray(), vformat("Failed to create a snapshot of physics space with RID '%d'.", rid.get_id()));
+
+	return recorder.get_data();
+}
+
+bool JoltSpace3D::restore_snapshot(const PackedByteArray &p_snapshot) {
+	ERR_FAIL_COND_V_MSG(stepping, false, vformat("Can't restore a snapshot of physics space with RID '%d' while it is being stepped.", rid.get_id()));
+	ERR_FAIL_COND_V_MSG(p_snapshot.is_empty(), false, vformat("Can't restore an empty snapshot of physics space with RID '%d'.", rid.get_id()));
+
+	flush_pending_objects();
+
+	JoltStateRecorder recorder(p_snapshot);
+	const bool restored = physics_system->RestoreState(recorder);
+	ERR_FAIL_COND_V_MSG(!restored || recorder.IsFailed(), false, vformat("Failed to restore snapshot of physics space with RID '%d'. The snapshot is either corrupted or was taken with a different set of bodies.", rid.get_id()));
+
+	return true;
+}
+
 #ifdef DEBUG_ENABLED
 
 void JoltSpace3D::dump_debug_snapshot(const String &p_dir) {
@@ -154,6 +154,9 @@ public:
 	void remove_joint(JPH::Constraint *p_jolt_ref);
 	void remove_joint(JoltJoint3D *p_joint);
 
+	PackedByteArray create_snapshot();
+	bool restore_snapshot(const PackedByteArray &p_snapshot);
+
 #ifdef DEBUG_ENABLED
 	void dump_debug_snapshot(const String &p_dir);
 	const PackedVector3Array &get_debug_contacts() const;
@@ -234,6 +234,34 @@ real_t GodotNavigationServer3D::map_get_link_connection_radius(RID p_map) const
 	return map->get_link_connection_radius();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
+COMMAND_2(map_set_use_path_cache, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_path_cache(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_path_cache(RID p_map) const {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_path_cache();
+}
+
 Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector<Vector3>());
@@ -1215,6 +1243,22 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
 }
 
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_callback);
+}
+
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_callback);
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 	return NavMeshGenerator3D::get_singleton()->is_baking(p_navigation_mesh);
 }
@@ -1403,6 +1447,7 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	uint64_t _new_pm_avoidance_time_usec = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
@@ -1419,6 +1464,7 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_avoidance_time_usec += active_maps[i]->get_pm_avoidance_time_usec();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1430,6 +1476,7 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_avoidance_time_usec = _new_pm_avoidance_time_usec;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1544,6 +1591,9 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_AVOIDANCE_TIME: {
+			return MIN(pm_avoidance_time_usec, (uint64_t)INT32_MAX);
+		} break;
 	}
 
 	return 0;
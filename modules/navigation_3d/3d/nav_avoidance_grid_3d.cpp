@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_avoidance_grid_3d.h"
+
+void NavAvoidanceGrid3D::build(const LocalVector<Vector3> &p_positions, real_t p_cell_size, bool p_use_height) {
+	const uint32_t agent_count = p_positions.size();
+
+	cell_size = MAX(p_cell_size, (real_t)CMP_EPSILON);
+	inv_cell_size = 1.0 / cell_size;
+	use_height = p_use_height;
+
+	const uint32_t bucket_count = next_power_of_2(MAX(agent_count * 2, 1u));
+	bucket_mask = bucket_count - 1;
+
+	bucket_offsets.resize(bucket_count + 1);
+	memset(bucket_offsets.ptr(), 0, sizeof(uint32_t) * bucket_offsets.size());
+	agent_buckets.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const Vector3 &position = p_positions[i];
+		const int32_t cell_x = (int32_t)Math::floor(position.x * inv_cell_size);
+		const int32_t cell_y = use_height ? (int32_t)Math::floor(position.y * inv_cell_size) : 0;
+		const int32_t cell_z = (int32_t)Math::floor(position.z * inv_cell_size);
+
+		const uint32_t bucket = _get_bucket(cell_x, cell_y, cell_z);
+		agent_buckets[i] = bucket;
+		bucket_offsets[bucket]++;
+	}
+
+	// Turn the counts into the end of each bucket.
+	for (uint32_t i = 1; i < bucket_count; i++) {
+		bucket_offsets[i] += bucket_offsets[i - 1];
+	}
+	bucket_offsets[bucket_count] = agent_count;
+
+	sorted_agent_indices.resize(agent_count);
+	sorted_agent_positions.resize(agent_count);
+
+	// Fill the buckets back to front so that the offsets end up at the start of each bucket again.
+	for (uint32_t i = agent_count; i > 0; i--) {
+		const uint32_t agent_index = i - 1;
+		const uint32_t sorted_index = --bucket_offsets[agent_buckets[agent_index]];
+		sorted_agent_indices[sorted_index] = agent_index;
+		sorted_agent_positions[sorted_index] = p_positions[agent_index];
+	}
+}
+
+void NavAvoidanceGrid3D::clear() {
+	bucket_offsets.clear();
+	sorted_agent_indices.clear();
+	sorted_agent_positions.clear();
+	agent_buckets.clear();
+}
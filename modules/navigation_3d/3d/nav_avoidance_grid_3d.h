@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/templates/local_vector.h"
+
+/// Uniform grid for the avoidance neighbor search of dense crowds.
+/// Agents are bucketed by their cell with a counting sort, so building is linear in the agent count.
+/// The cell size is the largest neighbor distance, so the neighbors of an agent are always in adjacent cells.
+class NavAvoidanceGrid3D {
+	real_t cell_size = 1.0;
+	real_t inv_cell_size = 1.0;
+	bool use_height = false;
+	uint32_t bucket_mask = 0;
+
+	// Start of each bucket in the sorted arrays, with one extra entry for the end of the last bucket.
+	LocalVector<uint32_t> bucket_offsets;
+	// Agent indices and positions sorted by bucket, positions are kept separate for the distance checks.
+	LocalVector<uint32_t> sorted_agent_indices;
+	LocalVector<Vector3> sorted_agent_positions;
+
+	LocalVector<uint32_t> agent_buckets;
+
+	_FORCE_INLINE_ uint32_t _get_bucket(int32_t p_x, int32_t p_y, int32_t p_z) const {
+		return ((uint32_t)p_x * 73856093u ^ (uint32_t)p_y * 19349663u ^ (uint32_t)p_z * 83492791u) & bucket_mask;
+	}
+
+public:
+	/// Builds the grid from the agent positions, for 2D avoidance the height of all positions should be zero and `p_use_height` false.
+	void build(const LocalVector<Vector3> &p_positions, real_t p_cell_size, bool p_use_height);
+	void clear();
+
+	/// Calls `p_callback(agent_index)` for every agent in the cells around `p_position` closer than `r_range_sq`.
+	/// The callback can shrink `r_range_sq`, like the RVO agents do once their neighbor list is full.
+	template <typename T>
+	void query(const Vector3 &p_position, const float &r_range_sq, T p_callback) const {
+		if (sorted_agent_indices.is_empty()) {
+			return;
+		}
+
+		const int32_t cell_x = (int32_t)Math::floor(p_position.x * inv_cell_size);
+		const int32_t cell_y = use_height ? (int32_t)Math::floor(p_position.y * inv_cell_size) : 0;
+		const int32_t cell_z = (int32_t)Math::floor(p_position.z * inv_cell_size);
+		const int32_t height_range = use_height ? 1 : 0;
+
+		// Different cells can share a bucket, visit each bucket only once to not report agents twice.
+		uint32_t visited_buckets[27];
+		uint32_t visited_bucket_count = 0;
+
+		const Vector3 *positions = sorted_agent_positions.ptr();
+		for (int32_t z = cell_z - 1; z <= cell_z + 1; z++) {
+			for (int32_t y = cell_y - height_range; y <= cell_y + height_range; y++) {
+				for (int32_t x = cell_x - 1; x <= cell_x + 1; x++) {
+					const uint32_t bucket = _get_bucket(x, y, z);
+
+					bool visited = false;
+					for (uint32_t i = 0; i < visited_bucket_count; i++) {
+						if (visited_buckets[i] == bucket) {
+							visited = true;
+							break;
+						}
+					}
+					if (visited) {
+						continue;
+					}
+					visited_buckets[visited_bucket_count++] = bucket;
+
+					const uint32_t bucket_end = bucket_offsets[bucket + 1];
+					for (uint32_t i = bucket_offsets[bucket]; i < bucket_end; i++) {
+						if (positions[i].distance_squared_to(p_position) < r_range_sq) {
+							p_callback(sorted_agent_indices[i]);
+						}
+					}
+				}
+			}
+		}
+	}
+};
@@ -62,6 +62,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_gather_region_polygons(r_build);
 
+	_build_step_find_changed_regions(r_build);
+
 	_build_step_find_edge_connection_pairs(r_build);
 
 	_build_step_merge_edge_connection_pairs(r_build);
@@ -70,7 +72,16 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	if (r_build.use_hierarchical_pathfinding) {
+		_build_step_path_hierarchy(r_build);
+	}
+
 	_build_update_map_iteration(r_build);
+
+	// No kept connection points to the polygons of the removed regions anymore.
+	for (const NavBaseIteration3D *removed_region : r_build.iter_removed_regions) {
+		r_build.iter_connected_regions.erase(removed_region);
+	}
 }
 
 void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D &r_build) {
@@ -100,27 +111,85 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_find_changed_regions(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	// Changed map settings invalidate all connections kept from the previous build.
+	if (r_build.iter_merge_rasterizer_cell_size != r_build.merge_rasterizer_cell_size ||
+			r_build.iter_use_edge_connections != r_build.use_edge_connections ||
+			r_build.iter_edge_connection_margin != r_build.edge_connection_margin ||
+			r_build.iter_link_connection_radius != r_build.link_connection_radius) {
+		r_build.clear_connections();
+		r_build.iter_merge_rasterizer_cell_size = r_build.merge_rasterizer_cell_size;
+		r_build.iter_use_edge_connections = r_build.use_edge_connections;
+		r_build.iter_edge_connection_margin = r_build.edge_connection_margin;
+		r_build.iter_link_connection_radius = r_build.link_connection_radius;
+	}
+
+	// Regions that changed got a new iteration, so they count as removed with their old and added with their new iteration.
+	HashSet<const NavBaseIteration3D *> map_regions;
+	map_regions.reserve(map_iteration->region_iterations.size());
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		map_regions.insert(region.ptr());
+		if (!r_build.iter_connected_regions.has(region.ptr())) {
+			r_build.iter_connected_regions.insert(region.ptr(), region);
+			r_build.iter_added_regions.push_back(region.ptr());
+			r_build.iter_dirty_regions.insert(region.ptr());
+		}
+	}
+
+	for (const KeyValue<const NavBaseIteration3D *, Ref<NavRegionIteration3D>> &E : r_build.iter_connected_regions) {
+		if (!map_regions.has(E.key)) {
+			r_build.iter_removed_regions.insert(E.key);
+		}
+	}
+}
+
 void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
+	const HashSet<const NavBaseIteration3D *> &removed_regions = r_build.iter_removed_regions;
+	HashSet<const NavBaseIteration3D *> &dirty_regions = r_build.iter_dirty_regions;
 
 	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
 
-	// Group all edges per key.
-	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
-	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
+	// Remove the edges of the removed regions. Regions whose edges lose their partner get a free edge.
+	for (const NavBaseIteration3D *removed_region : removed_regions) {
+		const Ref<NavRegionIteration3D> &region = r_build.iter_connected_regions[removed_region];
+
+		for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
+			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(connectable_edge.ek);
+			if (!pair_it) {
+				continue;
+			}
+
+			EdgeConnectionPair &pair = pair_it->value;
+			const Polygon *polygon = &region->navmesh_polygons[connectable_edge.polygon_index];
+			for (int i = 0; i < pair.size; i++) {
+				if (pair.connections[i].polygon == polygon && pair.connections[i].edge == connectable_edge.edge) {
+					pair.connections[i] = pair.connections[pair.size - 1];
+					--pair.size;
+					break;
+				}
+			}
+
+			if (pair.size == 0) {
+				connection_pairs_map.remove(pair_it);
+			} else if (pair.size == 1 && !removed_regions.has(pair.connections[0].polygon->owner)) {
+				dirty_regions.insert(pair.connections[0].polygon->owner);
+			}
+		}
+	}
+
+	// Group the edges of the added regions per key. Regions whose free edges get a partner lose a free edge.
+	for (const NavRegionIteration3D *added_region : r_build.iter_added_regions) {
+		const Ref<NavRegionIteration3D> &region = r_build.iter_connected_regions[added_region];
 
-	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
 		for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
 			const EdgeKey &ek = connectable_edge.ek;
 
 			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
 			if (!pair_it) {
 				pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-				performance_data.pm_edge_count += 1;
-				++free_edges_count;
 			}
 			EdgeConnectionPair &pair = pair_it->value;
 			if (pair.size < 2) {
@@ -134,7 +203,7 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 				pair.connections[pair.size] = new_connection;
 				++pair.size;
 				if (pair.size == 2) {
-					--free_edges_count;
+					dirty_regions.insert(pair.connections[0].polygon->owner);
 				}
 
 			} else {
@@ -144,7 +213,7 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 		}
 	}
 
-	r_build.free_edge_count = free_edges_count;
+	performance_data.pm_edge_count = connection_pairs_map.size();
 }
 
 void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
@@ -152,11 +221,9 @@ void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBui
 
 	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
 	LocalVector<Connection> &free_edges = r_build.iter_free_edges;
-	int free_edges_count = r_build.free_edge_count;
 	bool use_edge_connections = r_build.use_edge_connections;
 
 	free_edges.clear();
-	free_edges.reserve(free_edges_count);
 
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -180,6 +247,52 @@ void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBui
 			}
 		}
 	}
+
+	r_build.free_edge_count = free_edges.size();
+}
+
+static bool _build_edge_margin_connection(const Connection &p_free_edge, const Connection &p_other_edge, real_t p_edge_connection_margin_squared, Connection &r_connection) {
+	const Vector3 &edge_p1 = p_free_edge.pathway_start;
+	const Vector3 &edge_p2 = p_free_edge.pathway_end;
+	const Vector3 &other_edge_p1 = p_other_edge.pathway_start;
+	const Vector3 &other_edge_p2 = p_other_edge.pathway_end;
+
+	// Compute the projection of the opposite edge on the current one
+	Vector3 edge_vector = edge_p2 - edge_p1;
+	real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
+	real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
+	if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+		return false;
+	}
+
+	// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+	Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other1;
+	if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+		other1 = other_edge_p1;
+	} else {
+		other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other1.distance_squared_to(self1) > p_edge_connection_margin_squared) {
+		return false;
+	}
+
+	Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+	Vector3 other2;
+	if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+		other2 = other_edge_p2;
+	} else {
+		other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+	}
+	if (other2.distance_squared_to(self2) > p_edge_connection_margin_squared) {
+		return false;
+	}
+
+	// The edges can now be connected.
+	r_connection = p_other_edge;
+	r_connection.pathway_start = (self1 + other1) / 2.0;
+	r_connection.pathway_end = (self2 + other2) / 2.0;
+	return true;
 }
 
 void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build) {
@@ -193,6 +306,10 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 
 	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
 
+	const HashSet<const NavBaseIteration3D *> &removed_regions = r_build.iter_removed_regions;
+	const HashSet<const NavBaseIteration3D *> &dirty_regions = r_build.iter_dirty_regions;
+	HashMap<const NavBaseIteration3D *, LocalVector<NavMapIterationBuild3D::MarginConnection>> &margin_connections = r_build.iter_margin_connections;
+
 	// Find the compatible near edges.
 	//
 	// Note:
@@ -204,10 +321,57 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 
 	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
 
+	// Keep the connections between regions whose free edges did not change since the last build.
+	LocalVector<const NavBaseIteration3D *> removed_margin_connections;
+	for (KeyValue<const NavBaseIteration3D *, LocalVector<NavMapIterationBuild3D::MarginConnection>> &E : margin_connections) {
+		if (removed_regions.has(E.key)) {
+			removed_margin_connections.push_back(E.key);
+			continue;
+		}
+		if (dirty_regions.has(E.key)) {
+			E.value.clear();
+			continue;
+		}
+
+		uint32_t kept_count = 0;
+		for (uint32_t i = 0; i < E.value.size(); i++) {
+			const NavMapIterationBuild3D::MarginConnection &margin_connection = E.value[i];
+			const NavBaseIteration3D *other_owner = margin_connection.connection.polygon->owner;
+			if (removed_regions.has(other_owner) || dirty_regions.has(other_owner)) {
+				continue;
+			}
+
+			region_external_connections[E.key].push_back(margin_connection.connection);
+			navbases_polygons_external_connections[E.key][margin_connection.polygon_id].push_back(margin_connection.connection);
+			performance_data.pm_edge_connection_count += 1;
+			E.value[kept_count++] = margin_connection;
+		}
+		E.value.resize(kept_count);
+	}
+	for (const NavBaseIteration3D *removed_region : removed_margin_connections) {
+		margin_connections.erase(removed_region);
+	}
+
+	const auto add_margin_connection = [&](const Connection &p_free_edge, const Connection &p_connection) {
+		const NavBaseIteration3D *owner = p_free_edge.polygon->owner;
+
+		// Add the connection to the region_connection map.
+		region_external_connections[owner].push_back(p_connection);
+		navbases_polygons_external_connections[owner][p_free_edge.polygon->id].push_back(p_connection);
+		performance_data.pm_edge_connection_count += 1;
+
+		NavMapIterationBuild3D::MarginConnection margin_connection;
+		margin_connection.polygon_id = p_free_edge.polygon->id;
+		margin_connection.connection = p_connection;
+		margin_connections[owner].push_back(margin_connection);
+	};
+
+	// Connect the free edges of the dirty regions with all free edges in both directions.
 	for (uint32_t i = 0; i < free_edges.size(); i++) {
 		const Connection &free_edge = free_edges[i];
-		const Vector3 &edge_p1 = free_edge.pathway_start;
-		const Vector3 &edge_p2 = free_edge.pathway_end;
+		if (!dirty_regions.has(free_edge.polygon->owner)) {
+			continue;
+		}
 
 		for (uint32_t j = 0; j < free_edges.size(); j++) {
 			const Connection &other_edge = free_edges[j];
@@ -215,52 +379,73 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 				continue;
 			}
 
-			const Vector3 &other_edge_p1 = other_edge.pathway_start;
-			const Vector3 &other_edge_p2 = other_edge.pathway_end;
-
-			// Compute the projection of the opposite edge on the current one
-			Vector3 edge_vector = edge_p2 - edge_p1;
-			real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / (edge_vector.length_squared());
-			real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / (edge_vector.length_squared());
-			if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-				continue;
+			Connection new_connection;
+			if (_build_edge_margin_connection(free_edge, other_edge, edge_connection_margin_squared, new_connection)) {
+				add_margin_connection(free_edge, new_connection);
 			}
-
-			// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-			Vector3 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-			Vector3 other1;
-			if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-				other1 = other_edge_p1;
-			} else {
-				other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other1.distance_squared_to(self1) > edge_connection_margin_squared) {
-				continue;
+			// Connections from other dirty regions are found when their own free edges are visited.
+			if (!dirty_regions.has(other_edge.polygon->owner) && _build_edge_margin_connection(other_edge, free_edge, edge_connection_margin_squared, new_connection)) {
+				add_margin_connection(other_edge, new_connection);
 			}
+		}
+	}
+}
 
-			Vector3 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-			Vector3 other2;
-			if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-				other2 = other_edge_p2;
-			} else {
-				other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other2.distance_squared_to(self2) > edge_connection_margin_squared) {
-				continue;
-			}
+void NavMapBuilder3D::_build_find_navlink_polygons(NavMapIterationBuild3D &r_build, const Vector3 &p_link_start_pos, const Vector3 &p_link_end_pos, NavMapIterationBuild3D::LinkConnection &r_link_connection) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	real_t link_connection_radius = r_build.link_connection_radius;
+	real_t link_connection_radius_sqr = link_connection_radius * link_connection_radius;
 
-			// The edges can now be connected.
-			Connection new_connection = other_edge;
-			new_connection.pathway_start = (self1 + other1) / 2.0;
-			new_connection.pathway_end = (self2 + other2) / 2.0;
-			//free_edge.polygon->connections.push_back(new_connection);
+	Polygon *closest_start_polygon = nullptr;
+	real_t closest_start_sqr_dist = link_connection_radius_sqr;
+	Vector3 closest_start_point;
 
-			// Add the connection to the region_connection map.
-			region_external_connections[free_edge.polygon->owner].push_back(new_connection);
-			navbases_polygons_external_connections[free_edge.polygon->owner][free_edge.polygon->id].push_back(new_connection);
-			performance_data.pm_edge_connection_count += 1;
+	Polygon *closest_end_polygon = nullptr;
+	real_t closest_end_sqr_dist = link_connection_radius_sqr;
+	Vector3 closest_end_point;
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		AABB region_bounds = region->get_bounds().grow(link_connection_radius);
+		if (!region_bounds.has_point(p_link_start_pos) && !region_bounds.has_point(p_link_end_pos)) {
+			continue;
+		}
+
+		for (Polygon &polyon : region->navmesh_polygons) {
+			for (uint32_t point_id = 2; point_id < polyon.vertices.size(); point_id += 1) {
+				const Face3 face(polyon.vertices[0], polyon.vertices[point_id - 1], polyon.vertices[point_id]);
+
+				{
+					const Vector3 start_point = face.get_closest_point_to(p_link_start_pos);
+					const real_t sqr_dist = start_point.distance_squared_to(p_link_start_pos);
+
+					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+					if (sqr_dist < closest_start_sqr_dist) {
+						closest_start_sqr_dist = sqr_dist;
+						closest_start_point = start_point;
+						closest_start_polygon = &polyon;
+					}
+				}
+
+				{
+					const Vector3 end_point = face.get_closest_point_to(p_link_end_pos);
+					const real_t sqr_dist = end_point.distance_squared_to(p_link_end_pos);
+
+					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+					if (sqr_dist < closest_end_sqr_dist) {
+						closest_end_sqr_dist = sqr_dist;
+						closest_end_point = end_point;
+						closest_end_polygon = &polyon;
+					}
+				}
+			}
 		}
 	}
+
+	r_link_connection.start_polygon = closest_start_polygon;
+	r_link_connection.start_point = closest_start_point;
+	r_link_connection.end_polygon = closest_end_polygon;
+	r_link_connection.end_point = closest_end_point;
 }
 
 void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_build) {
@@ -272,14 +457,16 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 
 	int polygon_count = r_build.polygon_count;
 
-	real_t link_connection_radius_sqr = link_connection_radius * link_connection_radius;
-
 	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
 	LocalVector<Nav3D::Polygon> &navlink_polygons = map_iteration->navlink_polygons;
 	navlink_polygons.clear();
 	navlink_polygons.resize(links.size());
 	uint32_t navlink_index = 0;
 
+	HashMap<const NavBaseIteration3D *, NavMapIterationBuild3D::LinkConnection> &link_connections = r_build.iter_link_connections;
+	HashSet<const NavBaseIteration3D *> map_links;
+	map_links.reserve(links.size());
+
 	// Search for polygons within range of a nav link.
 	for (const Ref<NavLinkIteration3D> &link : links) {
 		polygon_count++;
@@ -291,51 +478,39 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 		const Vector3 link_start_pos = link->get_start_position();
 		const Vector3 link_end_pos = link->get_end_position();
 
-		Polygon *closest_start_polygon = nullptr;
-		real_t closest_start_sqr_dist = link_connection_radius_sqr;
-		Vector3 closest_start_point;
-
-		Polygon *closest_end_polygon = nullptr;
-		real_t closest_end_sqr_dist = link_connection_radius_sqr;
-		Vector3 closest_end_point;
+		map_links.insert(link.ptr());
 
-		for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
-			AABB region_bounds = region->get_bounds().grow(link_connection_radius);
-			if (!region_bounds.has_point(link_start_pos) && !region_bounds.has_point(link_end_pos)) {
-				continue;
+		// The polygons found for an unchanged link stay valid as long as they were not removed
+		// and no added region could have a closer polygon.
+		NavMapIterationBuild3D::LinkConnection *link_connection = link_connections.getptr(link.ptr());
+		bool link_connection_valid = link_connection != nullptr;
+		if (link_connection_valid) {
+			if ((link_connection->start_polygon && r_build.iter_removed_regions.has(link_connection->start_polygon->owner)) ||
+					(link_connection->end_polygon && r_build.iter_removed_regions.has(link_connection->end_polygon->owner))) {
+				link_connection_valid = false;
 			}
-
-			for (Polygon &polyon : region->navmesh_polygons) {
-				for (uint32_t point_id = 2; point_id < polyon.vertices.size(); point_id += 1) {
-					const Face3 face(polyon.vertices[0], polyon.vertices[point_id - 1], polyon.vertices[point_id]);
-
-					{
-						const Vector3 start_point = face.get_closest_point_to(link_start_pos);
-						const real_t sqr_dist = start_point.distance_squared_to(link_start_pos);
-
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_start_sqr_dist) {
-							closest_start_sqr_dist = sqr_dist;
-							closest_start_point = start_point;
-							closest_start_polygon = &polyon;
-						}
-					}
-
-					{
-						const Vector3 end_point = face.get_closest_point_to(link_end_pos);
-						const real_t sqr_dist = end_point.distance_squared_to(link_end_pos);
-
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_end_sqr_dist) {
-							closest_end_sqr_dist = sqr_dist;
-							closest_end_point = end_point;
-							closest_end_polygon = &polyon;
-						}
-					}
+		}
+		if (link_connection_valid) {
+			for (const NavRegionIteration3D *added_region : r_build.iter_added_regions) {
+				AABB region_bounds = added_region->get_bounds().grow(link_connection_radius);
+				if (region_bounds.has_point(link_start_pos) || region_bounds.has_point(link_end_pos)) {
+					link_connection_valid = false;
+					break;
 				}
 			}
 		}
 
+		if (!link_connection_valid) {
+			link_connection = &link_connections[link.ptr()];
+			link_connection->link = link;
+			_build_find_navlink_polygons(r_build, link_start_pos, link_end_pos, *link_connection);
+		}
+
+		Polygon *closest_start_polygon = link_connection->start_polygon;
+		const Vector3 closest_start_point = link_connection->start_point;
+		Polygon *closest_end_polygon = link_connection->end_polygon;
+		const Vector3 closest_end_point = link_connection->end_point;
+
 		// If we have both a start and end point, then create a synthetic polygon to route through.
 		if (closest_start_polygon && closest_end_polygon) {
 			new_polygon.vertices.resize(4);
@@ -384,9 +559,65 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 		}
 	}
 
+	// Drop the found polygons of links that left the map.
+	LocalVector<const NavBaseIteration3D *> removed_links;
+	for (const KeyValue<const NavBaseIteration3D *, NavMapIterationBuild3D::LinkConnection> &E : link_connections) {
+		if (!map_links.has(E.key)) {
+			removed_links.push_back(E.key);
+		}
+	}
+	for (const NavBaseIteration3D *removed_link : removed_links) {
+		link_connections.erase(removed_link);
+	}
+
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_path_hierarchy(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<Portal> &portals = map_iteration->portals;
+	HashMap<const NavBaseIteration3D *, LocalVector<uint32_t>> &navbases_portals = map_iteration->navbases_portals;
+	portals.clear();
+	navbases_portals.clear();
+
+	// Each navigation region and link is a cluster of the abstract graph. All external
+	// connections between two clusters are merged into a single portal per direction.
+	LocalVector<uint32_t> portal_connection_counts;
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &E : map_iteration->navbases_polygons_external_connections) {
+		const NavBaseIteration3D *navbase = E.key;
+		HashMap<const NavBaseIteration3D *, uint32_t> navbase_portal_ids;
+
+		for (const LocalVector<Connection> &polygon_connections : E.value) {
+			for (const Connection &connection : polygon_connections) {
+				const NavBaseIteration3D *connection_owner = connection.polygon->owner;
+				if (connection_owner == navbase) {
+					continue;
+				}
+
+				HashMap<const NavBaseIteration3D *, uint32_t>::Iterator portal_id = navbase_portal_ids.find(connection_owner);
+				if (!portal_id) {
+					portal_id = navbase_portal_ids.insert(connection_owner, portals.size());
+					navbases_portals[navbase].push_back(portals.size());
+
+					Portal portal;
+					portal.from = navbase;
+					portal.to = connection_owner;
+					portals.push_back(portal);
+					portal_connection_counts.push_back(0);
+				}
+
+				portals[portal_id->value].position += (connection.pathway_start + connection.pathway_end) * 0.5;
+				portal_connection_counts[portal_id->value] += 1;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < portals.size(); i++) {
+		portals[i].position /= (real_t)portal_connection_counts[i];
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -420,7 +651,13 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		}
 
 		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+
+		p_path_query_slot.traversable_portals.clear();
+		p_path_query_slot.portal_corridor.clear();
+		p_path_query_slot.portal_corridor.resize(map_iteration->portals.size());
 	}
 
 	map_iteration->path_query_slots_mutex.unlock();
+
+	map_iteration->use_path_cache = r_build.use_path_cache;
 }
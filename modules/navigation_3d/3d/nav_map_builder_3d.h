@@ -31,15 +31,17 @@
 #pragma once
 
 #include "../nav_utils_3d.h"
-
-struct NavMapIterationBuild3D;
+#include "nav_map_iteration_3d.h"
 
 class NavMapBuilder3D {
 	static void _build_step_gather_region_polygons(NavMapIterationBuild3D &r_build);
+	static void _build_step_find_changed_regions(NavMapIterationBuild3D &r_build);
 	static void _build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
+	static void _build_find_navlink_polygons(NavMapIterationBuild3D &r_build, const Vector3 &p_link_start_pos, const Vector3 &p_link_end_pos, NavMapIterationBuild3D::LinkConnection &r_link_connection);
+	static void _build_step_path_hierarchy(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
 public:
@@ -36,6 +36,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/os/semaphore.h"
+#include "core/templates/hash_set.h"
 
 class NavLinkIteration3D;
 class NavRegion3D;
@@ -45,28 +46,70 @@ struct NavMapIteration3D;
 struct NavMapIterationBuild3D {
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
+	bool use_hierarchical_pathfinding = false;
+	bool use_path_cache = false;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
 
-	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
 	LocalVector<Nav3D::Connection> iter_free_edges;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
 	int navmesh_polygon_count = 0;
 
+	// The edge pairs, edge margin connections and link connections are kept between builds,
+	// so that only the regions and links that changed since the last build are connected again.
+	// The kept region iterations keep the polygons alive that the kept connections point to.
+	struct MarginConnection {
+		uint32_t polygon_id = 0;
+		Nav3D::Connection connection;
+	};
+
+	struct LinkConnection {
+		Ref<NavLinkIteration3D> link;
+		Nav3D::Polygon *start_polygon = nullptr;
+		Vector3 start_point;
+		Nav3D::Polygon *end_polygon = nullptr;
+		Vector3 end_point;
+	};
+
+	Vector3 iter_merge_rasterizer_cell_size;
+	bool iter_use_edge_connections = true;
+	real_t iter_edge_connection_margin = 0.0;
+	real_t iter_link_connection_radius = 0.0;
+
+	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
+	HashMap<const NavBaseIteration3D *, Ref<NavRegionIteration3D>> iter_connected_regions;
+	HashMap<const NavBaseIteration3D *, LocalVector<MarginConnection>> iter_margin_connections;
+	HashMap<const NavBaseIteration3D *, LinkConnection> iter_link_connections;
+
+	// The regions that joined or left the map since the last build, and all regions whose free edges changed.
+	LocalVector<const NavRegionIteration3D *> iter_added_regions;
+	HashSet<const NavBaseIteration3D *> iter_removed_regions;
+	HashSet<const NavBaseIteration3D *> iter_dirty_regions;
+
 	void reset() {
 		performance_data.reset();
 
-		iter_connection_pairs_map.clear();
 		iter_free_edges.clear();
 		polygon_count = 0;
 		free_edge_count = 0;
 
 		navmesh_polygon_count = 0;
+
+		iter_added_regions.clear();
+		iter_removed_regions.clear();
+		iter_dirty_regions.clear();
+	}
+
+	void clear_connections() {
+		iter_connection_pairs_map.clear();
+		iter_connected_regions.clear();
+		iter_margin_connections.clear();
+		iter_link_connections.clear();
 	}
 };
 
@@ -87,8 +130,19 @@ struct NavMapIteration3D {
 
 	LocalVector<Nav3D::Polygon> navlink_polygons;
 
+	// The abstract graph for hierarchical path queries, empty when the map doesn't use them.
+	LocalVector<Nav3D::Portal> portals;
+	HashMap<const NavBaseIteration3D *, LocalVector<uint32_t>> navbases_portals;
+
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
+	// Routes found by path queries, as trees of the next polygon towards each end polygon.
+	// Filled while the iteration is used by queries, and dropped with it when the map changes.
+	static constexpr uint32_t PATH_CACHE_MAX_ROUTES = 256;
+	bool use_path_cache = false;
+	mutable RWLock path_cache_rwlock;
+	mutable HashMap<Nav3D::PathCacheKey, AHashMap<const Nav3D::Polygon *, Nav3D::PathCacheHop>, Nav3D::PathCacheKey> path_cache;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -102,7 +156,11 @@ struct NavMapIteration3D {
 		external_region_connections.clear();
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
+		portals.clear();
+		navbases_portals.clear();
 		region_ptr_to_region_iteration.clear();
+		use_path_cache = false;
+		path_cache.clear();
 	}
 };
 
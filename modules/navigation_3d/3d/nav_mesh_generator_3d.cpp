@@ -41,12 +41,14 @@
 NavMeshGenerator3D *NavMeshGenerator3D::singleton = nullptr;
 Mutex NavMeshGenerator3D::baking_navmesh_mutex;
 Mutex NavMeshGenerator3D::generator_task_mutex;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
 RWLock NavMeshGenerator3D::generator_parsers_rwlock;
 bool NavMeshGenerator3D::use_threads = true;
 bool NavMeshGenerator3D::baking_use_multiple_threads = true;
 bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
 
 static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MAX] = {
@@ -133,6 +135,15 @@ void NavMeshGenerator3D::cleanup() {
 		}
 		generator_tasks.clear();
 
+		tile_cache_mutex.lock();
+		for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			// All bakes finished above, so nothing else references the tiles.
+			DEV_ASSERT(E.value->reference_count == 1);
+			memdelete(E.value);
+		}
+		tile_caches.clear();
+		tile_cache_mutex.unlock();
+
 		generator_parsers_rwlock.write_lock();
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
@@ -158,10 +169,33 @@ void NavMeshGenerator3D::parse_source_geometry_data(Ref<NavigationMesh> p_naviga
 }
 
 void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake(p_navigation_mesh, p_source_geometry_data, 0.0, p_callback);
+}
+
+void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, 0.0, p_callback);
+}
+
+void NavMeshGenerator3D::bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_tile_size <= 0.0, "Tile size must be greater than zero.");
+	generator_bake(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_callback);
+}
+
+void NavMeshGenerator3D::bake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_tile_size <= 0.0, "Tile size must be greater than zero.");
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_callback);
+}
+
+void NavMeshGenerator3D::generator_bake(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+	}
+
 	if (!p_source_geometry_data->has_data()) {
+		generator_erase_tile_cache(p_navigation_mesh);
 		p_navigation_mesh->clear();
 		if (p_callback.is_valid()) {
 			generator_emit_callback(p_callback);
@@ -169,10 +203,6 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 		p_navigation_mesh->emit_changed();
 		return;
 	}
-
-	if (is_baking(p_navigation_mesh)) {
-		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
-	}
 	baking_navmesh_mutex.lock();
 	NavMeshGeneratorTask3D generator_task;
 	baking_navmeshes.insert(p_navigation_mesh, &generator_task);
@@ -180,6 +210,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 
 	generator_task.navigation_mesh = p_navigation_mesh;
 	generator_task.source_geometry_data = p_source_geometry_data;
+	generator_task.tile_size = p_tile_size;
 	generator_task.status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 
 	generator_bake_from_source_geometry_data(&generator_task);
@@ -195,11 +226,17 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	p_navigation_mesh->emit_changed();
 }
 
-void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+void NavMeshGenerator3D::generator_bake_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+		return;
+	}
+
 	if (!p_source_geometry_data->has_data()) {
+		generator_erase_tile_cache(p_navigation_mesh);
 		p_navigation_mesh->clear();
 		if (p_callback.is_valid()) {
 			generator_emit_callback(p_callback);
@@ -209,12 +246,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	}
 
 	if (!use_threads) {
-		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
-		return;
-	}
-
-	if (is_baking(p_navigation_mesh)) {
-		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+		generator_bake(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_callback);
 		return;
 	}
 	baking_navmesh_mutex.lock();
@@ -225,6 +257,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	generator_task->navigation_mesh = p_navigation_mesh;
 	generator_task->source_geometry_data = p_source_geometry_data;
 	generator_task->callback = p_callback;
+	generator_task->tile_size = p_tile_size;
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
 	MutexLock generator_task_lock(generator_task_mutex);
@@ -247,6 +280,13 @@ String NavMeshGenerator3D::get_baking_state_msg(Ref<NavigationMesh> p_navigation
 	return bake_state_msg;
 }
 
+uint32_t NavMeshGenerator3D::get_last_rebaked_tile_count(Ref<NavigationMesh> p_navigation_mesh) {
+	ERR_FAIL_COND_V(p_navigation_mesh.is_null(), 0);
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D *const *tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	return tile_cache_ptr ? (*tile_cache_ptr)->last_rebaked_tile_count : 0;
+}
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -309,6 +349,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
+	if (p_generator_task->tile_size > 0.0) {
+		generator_bake_tiles_from_source_geometry_data(p_generator_task);
+		return;
+	}
+
 	Vector<float> source_geometry_vertices;
 	Vector<int> source_geometry_indices;
 	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
@@ -586,6 +631,571 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
 }
 
+static uint32_t _navmesh_tile_settings_hash(const Ref<NavigationMesh> &p_navigation_mesh, real_t p_tile_size) {
+	uint32_t h = hash_murmur3_one_real(p_tile_size);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_cell_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_cell_height(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_border_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_height(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_radius(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_max_climb(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_agent_max_slope(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_region_min_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_region_merge_size(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_edge_max_length(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_edge_max_error(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_vertices_per_polygon(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_detail_sample_distance(), h);
+	h = hash_murmur3_one_float(p_navigation_mesh->get_detail_sample_max_error(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), h);
+	h = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), h);
+	return h;
+}
+
+static Rect2i _navmesh_tile_range(real_t p_min_x, real_t p_min_z, real_t p_max_x, real_t p_max_z, real_t p_tile_size, real_t p_border_size) {
+	const Vector2i from((int)Math::floor((p_min_x - p_border_size) / p_tile_size), (int)Math::floor((p_min_z - p_border_size) / p_tile_size));
+	const Vector2i to((int)Math::floor((p_max_x + p_border_size) / p_tile_size), (int)Math::floor((p_max_z + p_border_size) / p_tile_size));
+	return Rect2i(from, to - from + Vector2i(1, 1));
+}
+
+void NavMeshGenerator3D::generator_unreference_tile_cache(NavMeshTileCache3D *p_tile_cache) {
+	// Expects the tile cache mutex to be locked.
+	if (--p_tile_cache->reference_count == 0) {
+		memdelete(p_tile_cache);
+	}
+}
+
+NavMeshGenerator3D::NavMeshTileCache3D *NavMeshGenerator3D::generator_acquire_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh, real_t p_tile_size) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	// Drop the tiles of navigation meshes that were freed since the last tiled bake.
+	LocalVector<ObjectID> freed_navmesh_ids;
+	for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed_navmesh_ids.push_back(E.key);
+		}
+	}
+	for (const ObjectID &freed_navmesh_id : freed_navmesh_ids) {
+		generator_unreference_tile_cache(tile_caches[freed_navmesh_id]);
+		tile_caches.erase(freed_navmesh_id);
+	}
+
+	NavMeshTileCache3D *tile_cache = nullptr;
+	NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	if (tile_cache_ptr) {
+		tile_cache = *tile_cache_ptr;
+	} else {
+		tile_cache = memnew(NavMeshTileCache3D);
+		tile_caches.insert(p_navigation_mesh->get_instance_id(), tile_cache);
+	}
+
+	if (tile_cache->tile_size != p_tile_size) {
+		// A different tile grid invalidates all cached tiles.
+		tile_cache->tiles.clear();
+		tile_cache->tile_size = p_tile_size;
+	}
+
+	tile_cache->reference_count++;
+	return tile_cache;
+}
+
+void NavMeshGenerator3D::generator_release_tile_cache(NavMeshTileCache3D *p_tile_cache) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	generator_unreference_tile_cache(p_tile_cache);
+}
+
+void NavMeshGenerator3D::generator_erase_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	HashMap<ObjectID, NavMeshTileCache3D *>::Iterator tile_cache_it = tile_caches.find(p_navigation_mesh->get_instance_id());
+	if (tile_cache_it) {
+		// A bake that still uses the tiles keeps them alive until it finishes.
+		generator_unreference_tile_cache(tile_cache_it->value);
+		tile_caches.remove(tile_cache_it);
+	}
+}
+
+void NavMeshGenerator3D::generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task) {
+	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
+	const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data = p_generator_task->source_geometry_data;
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			projected_obstructions);
+
+	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
+		return;
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
+
+	const real_t cell_size = p_navigation_mesh->get_cell_size();
+	const real_t cell_height = p_navigation_mesh->get_cell_height();
+
+	// Tiles start on the voxel grid so that the vertices along their seams line up.
+	const real_t tile_size = MAX(Math::round(p_generator_task->tile_size / cell_size), (real_t)1.0) * cell_size;
+	// Each tile also rasterizes a border of the neighboring geometry so that erosion and partitioning match across seams.
+	const real_t border_size = (Math::ceil(MAX(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_agent_radius()) / cell_size) + 3.0) * cell_size;
+
+	NavMeshTileCache3D *tile_cache = generator_acquire_tile_cache(p_navigation_mesh, tile_size);
+	const uint32_t settings_hash = _navmesh_tile_settings_hash(p_navigation_mesh, tile_size);
+
+	bool use_tile_limits = false;
+	Rect2i tile_limits;
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		baking_aabb.position += p_navigation_mesh->get_filter_baking_aabb_offset();
+		const Vector3 baking_aabb_end = baking_aabb.get_end();
+		tile_limits = _navmesh_tile_range(baking_aabb.position.x, baking_aabb.position.z, baking_aabb_end.x, baking_aabb_end.z, tile_size, 0.0);
+		use_tile_limits = true;
+	}
+
+	const float *verts = source_geometry_vertices.ptr();
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = source_geometry_indices.size() / 3;
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
+
+	// Assign all triangles and obstructions to the tiles whose bordered area they overlap.
+	HashMap<Vector2i, LocalVector<int>> tile_triangles;
+	HashMap<Vector2i, LocalVector<int>> tile_obstructions;
+
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+
+		Rect2i tile_range = _navmesh_tile_range(MIN(v0[0], MIN(v1[0], v2[0])), MIN(v0[2], MIN(v1[2], v2[2])), MAX(v0[0], MAX(v1[0], v2[0])), MAX(v0[2], MAX(v1[2], v2[2])), tile_size, border_size);
+		if (use_tile_limits) {
+			tile_range = tile_range.intersection(tile_limits);
+		}
+
+		for (int z = tile_range.position.y; z < tile_range.get_end().y; z++) {
+			for (int x = tile_range.position.x; x < tile_range.get_end().x; x++) {
+				tile_triangles[Vector2i(x, z)].push_back(i);
+			}
+		}
+	}
+
+	for (int i = 0; i < projected_obstructions.size(); i++) {
+		const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction = projected_obstructions[i];
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+
+		const float *obstruction_verts = projected_obstruction.vertices.ptr();
+		real_t min_x = obstruction_verts[0];
+		real_t min_z = obstruction_verts[2];
+		real_t max_x = min_x;
+		real_t max_z = min_z;
+		for (int j = 3; j < projected_obstruction.vertices.size(); j += 3) {
+			min_x = MIN(min_x, obstruction_verts[j + 0]);
+			min_z = MIN(min_z, obstruction_verts[j + 2]);
+			max_x = MAX(max_x, obstruction_verts[j + 0]);
+			max_z = MAX(max_z, obstruction_verts[j + 2]);
+		}
+
+		Rect2i tile_range = _navmesh_tile_range(min_x, min_z, max_x, max_z, tile_size, border_size);
+		if (use_tile_limits) {
+			tile_range = tile_range.intersection(tile_limits);
+		}
+
+		for (int z = tile_range.position.y; z < tile_range.get_end().y; z++) {
+			for (int x = tile_range.position.x; x < tile_range.get_end().x; x++) {
+				tile_obstructions[Vector2i(x, z)].push_back(i);
+			}
+		}
+	}
+
+	// Tiles that lost all their source geometry are dropped.
+	LocalVector<Vector2i> removed_tiles;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : tile_cache->tiles) {
+		if (!tile_triangles.has(E.key)) {
+			removed_tiles.push_back(E.key);
+		}
+	}
+	for (const Vector2i &removed_tile : removed_tiles) {
+		tile_cache->tiles.erase(removed_tile);
+	}
+
+	// Only tiles whose source geometry or bake settings changed since their last bake are dirty.
+	Ref<NavigationMesh> tile_template;
+	p_generator_task->tile_bakes.clear();
+
+	for (const KeyValue<Vector2i, LocalVector<int>> &E : tile_triangles) {
+		const LocalVector<int> *obstruction_indices = tile_obstructions.getptr(E.key);
+
+		uint32_t source_hash = settings_hash;
+		for (int triangle : E.value) {
+			for (int j = 0; j < 3; j++) {
+				source_hash = hash_murmur3_buffer(&verts[tris[triangle * 3 + j] * 3], 3 * sizeof(float), source_hash);
+			}
+		}
+		if (obstruction_indices) {
+			for (int obstruction_index : *obstruction_indices) {
+				const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction = projected_obstructions[obstruction_index];
+				source_hash = hash_murmur3_buffer(projected_obstruction.vertices.ptr(), projected_obstruction.vertices.size() * sizeof(float), source_hash);
+				source_hash = hash_murmur3_one_float(projected_obstruction.elevation, source_hash);
+				source_hash = hash_murmur3_one_float(projected_obstruction.height, source_hash);
+				source_hash = hash_murmur3_one_32(projected_obstruction.carve, source_hash);
+			}
+		}
+		source_hash = hash_fmix32(source_hash);
+
+		const NavMeshTile3D *tile = tile_cache->tiles.getptr(E.key);
+		if (tile && tile->source_hash == source_hash) {
+			continue;
+		}
+
+		LocalVector<float> tile_vertices;
+		Vector<int> tile_indices;
+		HashMap<int, int> source_to_tile_index;
+
+		tile_indices.resize(E.value.size() * 3);
+		int *tile_indices_ptrw = tile_indices.ptrw();
+		real_t min_y = verts[tris[E.value[0] * 3] * 3 + 1];
+		real_t max_y = min_y;
+
+		for (uint32_t i = 0; i < E.value.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				const int source_index = tris[E.value[i] * 3 + j];
+				const int *tile_index_ptr = source_to_tile_index.getptr(source_index);
+				if (tile_index_ptr) {
+					tile_indices_ptrw[i * 3 + j] = *tile_index_ptr;
+					continue;
+				}
+
+				const int tile_index = tile_vertices.size() / 3;
+				source_to_tile_index.insert(source_index, tile_index);
+				tile_indices_ptrw[i * 3 + j] = tile_index;
+
+				const float *v = &verts[source_index * 3];
+				tile_vertices.push_back(v[0]);
+				tile_vertices.push_back(v[1]);
+				tile_vertices.push_back(v[2]);
+				min_y = MIN(min_y, v[1]);
+				max_y = MAX(max_y, v[1]);
+			}
+		}
+
+		Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> tile_projected_obstructions;
+		if (obstruction_indices) {
+			for (int obstruction_index : *obstruction_indices) {
+				tile_projected_obstructions.push_back(projected_obstructions[obstruction_index]);
+			}
+		}
+
+		if (tile_template.is_null()) {
+			tile_template = p_navigation_mesh->duplicate();
+			tile_template->clear();
+			tile_template->set_border_size(border_size);
+			tile_template->set_filter_baking_aabb_offset(Vector3());
+		}
+
+		NavMeshTileBake3D tile_bake;
+		tile_bake.coords = E.key;
+		tile_bake.source_hash = source_hash;
+		tile_bake.source_geometry_data.instantiate();
+		tile_bake.source_geometry_data->set_data(tile_vertices, tile_indices, tile_projected_obstructions);
+		tile_bake.navigation_mesh = tile_template->duplicate();
+		tile_bake.navigation_mesh->set_filter_baking_aabb(AABB(
+				Vector3(E.key.x * tile_size - border_size, min_y - cell_height, E.key.y * tile_size - border_size),
+				Vector3(tile_size + border_size * 2.0, max_y - min_y + cell_height * 2.0, tile_size + border_size * 2.0)));
+
+		p_generator_task->tile_bakes.push_back(tile_bake);
+	}
+
+	if (!p_generator_task->tile_bakes.is_empty()) {
+		p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+
+		if (use_threads && p_generator_task->tile_bakes.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, p_generator_task, p_generator_task->tile_bakes.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < p_generator_task->tile_bakes.size(); i++) {
+				generator_thread_bake_tile(p_generator_task, i);
+			}
+		}
+
+		for (const NavMeshTileBake3D &tile_bake : p_generator_task->tile_bakes) {
+			NavMeshTile3D &tile = tile_cache->tiles[tile_bake.coords];
+			tile.source_hash = tile_bake.source_hash;
+			tile_bake.navigation_mesh->get_data(tile.vertices, tile.polygons);
+		}
+
+		print_verbose(vformat("NavigationMesh tiled bake rebaked %d of %d tiles.", p_generator_task->tile_bakes.size(), tile_cache->tiles.size()));
+	}
+
+	tile_cache_mutex.lock();
+	tile_cache->last_rebaked_tile_count = p_generator_task->tile_bakes.size();
+	tile_cache_mutex.unlock();
+	p_generator_task->tile_bakes.clear();
+
+	// The tiles are stitched even when none changed, the navigation mesh may have been cleared,
+	// set or baked without tiles since the last tiled bake.
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	// Vertices of the same surface on both sides of a seam are at most a climbable step apart.
+	generator_stitch_tiles(tile_cache, cell_size, MAX(p_navigation_mesh->get_agent_max_climb(), cell_height), nav_vertices, nav_polygons);
+	generator_release_tile_cache(tile_cache);
+
+	// Swaps all tiles in at once so the region never sees a partially rebaked navigation mesh.
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
+	const NavMeshTileBake3D &tile_bake = generator_task->tile_bakes[p_index];
+
+	NavMeshGeneratorTask3D tile_task;
+	tile_task.navigation_mesh = tile_bake.navigation_mesh;
+	tile_task.source_geometry_data = tile_bake.source_geometry_data;
+	tile_task.status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+
+	generator_bake_from_source_geometry_data(&tile_task);
+}
+
+void NavMeshGenerator3D::generator_stitch_tiles(const NavMeshTileCache3D *p_tile_cache, real_t p_cell_size, real_t p_seam_height, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	// Tiles are baked independently so the polygon edges along a shared seam are split at different points.
+	// All seam vertices are snapped onto their seam and merged, and every seam edge is split at the seam vertices
+	// of its neighbors, so that the edges of both sides match and the region connects them like any other edge.
+	// Seam vertices only merge and split edges within the seam height, so that stacked floors, bridges and ramps
+	// crossing the same seam stay apart.
+	struct SeamPoint {
+		real_t offset = 0.0; // Position along the seam.
+		uint32_t order = 0;
+		Vector3 position;
+	};
+
+	struct SeamPointComparator {
+		_FORCE_INLINE_ bool operator()(const SeamPoint &p_a, const SeamPoint &p_b) const { return p_a.offset < p_b.offset; }
+	};
+
+	struct TileVertex {
+		Vector3 position;
+		bool on_seam[2] = { false, false };
+		int seam[2] = { 0, 0 };
+	};
+
+	const real_t tile_size = p_tile_cache->tile_size;
+	const real_t seam_epsilon = p_cell_size * 0.25;
+	// Seams at a constant x run along the z axis, seams at a constant z run along the x axis.
+	const int seam_axis_coord[2] = { Vector3::AXIS_X, Vector3::AXIS_Z };
+	const int seam_offset_coord[2] = { Vector3::AXIS_Z, Vector3::AXIS_X };
+
+	HashMap<int, LocalVector<SeamPoint>> seams[2];
+	LocalVector<LocalVector<TileVertex>> tiles_vertices;
+	tiles_vertices.resize(p_tile_cache->tiles.size());
+
+	uint32_t tile_index = 0;
+	uint32_t seam_point_order = 0;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : p_tile_cache->tiles) {
+		LocalVector<TileVertex> &tile_vertices = tiles_vertices[tile_index++];
+		tile_vertices.resize(E.value.vertices.size());
+
+		for (int i = 0; i < E.value.vertices.size(); i++) {
+			TileVertex &tile_vertex = tile_vertices[i];
+			tile_vertex.position = E.value.vertices[i];
+
+			for (int axis = 0; axis < 2; axis++) {
+				const int tile_coord = axis == 0 ? E.key.x : E.key.y;
+				for (int seam = tile_coord; seam <= tile_coord + 1; seam++) {
+					const real_t seam_position = seam * tile_size;
+					if (Math::abs(tile_vertex.position[seam_axis_coord[axis]] - seam_position) < seam_epsilon) {
+						tile_vertex.position[seam_axis_coord[axis]] = seam_position;
+						tile_vertex.on_seam[axis] = true;
+						tile_vertex.seam[axis] = seam;
+						break;
+					}
+				}
+			}
+
+			for (int axis = 0; axis < 2; axis++) {
+				if (tile_vertex.on_seam[axis]) {
+					SeamPoint seam_point;
+					seam_point.offset = tile_vertex.position[seam_offset_coord[axis]];
+					seam_point.order = seam_point_order++;
+					seam_point.position = tile_vertex.position;
+					seams[axis][tile_vertex.seam[axis]].push_back(seam_point);
+				}
+			}
+		}
+	}
+
+	// Merges the points of each seam that are closer than the epsilon along the seam and closer than the seam height
+	// into the point that was found first.
+	for (int axis = 0; axis < 2; axis++) {
+		for (KeyValue<int, LocalVector<SeamPoint>> &E : seams[axis]) {
+			LocalVector<SeamPoint> &seam_points = E.value;
+			seam_points.sort_custom<SeamPointComparator>();
+
+			LocalVector<SeamPoint> merged_points;
+			LocalVector<bool> merged;
+			merged.resize(seam_points.size());
+			for (uint32_t i = 0; i < seam_points.size(); i++) {
+				merged[i] = false;
+			}
+
+			for (uint32_t i = 0; i < seam_points.size(); i++) {
+				if (merged[i]) {
+					continue;
+				}
+				uint32_t first_found = i;
+				for (uint32_t j = i + 1; j < seam_points.size() && seam_points[j].offset - seam_points[i].offset < seam_epsilon; j++) {
+					if (merged[j] || Math::abs(seam_points[j].position.y - seam_points[i].position.y) >= p_seam_height) {
+						continue;
+					}
+					merged[j] = true;
+					if (seam_points[j].order < seam_points[first_found].order) {
+						first_found = j;
+					}
+				}
+				merged_points.push_back(seam_points[first_found]);
+			}
+
+			merged_points.sort_custom<SeamPointComparator>();
+			seam_points = merged_points;
+		}
+	}
+
+	const auto find_seam_point = [](const LocalVector<SeamPoint> &p_seam_points, real_t p_offset) -> uint32_t {
+		// First seam point with an offset above the given one.
+		uint32_t low = 0;
+		uint32_t high = p_seam_points.size();
+		while (low < high) {
+			const uint32_t middle = (low + high) / 2;
+			if (p_seam_points[middle].offset <= p_offset) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		return low;
+	};
+
+	const auto find_closest_seam_point = [&find_seam_point, seam_epsilon, p_seam_height](const LocalVector<SeamPoint> &p_seam_points, const Vector3 &p_position, real_t p_offset) -> int {
+		int closest = -1;
+		real_t closest_distance = 0.0;
+		for (uint32_t j = find_seam_point(p_seam_points, p_offset - seam_epsilon); j < p_seam_points.size() && p_seam_points[j].offset < p_offset + seam_epsilon; j++) {
+			if (Math::abs(p_seam_points[j].position.y - p_position.y) >= p_seam_height) {
+				continue;
+			}
+			const real_t distance = Math::abs(p_seam_points[j].offset - p_offset);
+			if (closest < 0 || distance < closest_distance) {
+				closest = j;
+				closest_distance = distance;
+			}
+		}
+		return closest;
+	};
+
+	for (LocalVector<TileVertex> &tile_vertices : tiles_vertices) {
+		for (TileVertex &tile_vertex : tile_vertices) {
+			for (int axis = 0; axis < 2; axis++) {
+				if (!tile_vertex.on_seam[axis]) {
+					continue;
+				}
+				const LocalVector<SeamPoint> &seam_points = seams[axis][tile_vertex.seam[axis]];
+				const int closest = find_closest_seam_point(seam_points, tile_vertex.position, tile_vertex.position[seam_offset_coord[axis]]);
+				if (closest >= 0) {
+					tile_vertex.position = seam_points[closest].position;
+				}
+			}
+		}
+	}
+
+	HashMap<Vector3, int> vertex_indices;
+	LocalVector<Vector3> nav_vertices;
+
+	const auto get_vertex_index = [&vertex_indices, &nav_vertices](const Vector3 &p_vertex) -> int {
+		const int *existing_index_ptr = vertex_indices.getptr(p_vertex);
+		if (existing_index_ptr) {
+			return *existing_index_ptr;
+		}
+		const int new_index = nav_vertices.size();
+		vertex_indices.insert(p_vertex, new_index);
+		nav_vertices.push_back(p_vertex);
+		return new_index;
+	};
+
+	tile_index = 0;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : p_tile_cache->tiles) {
+		const LocalVector<TileVertex> &tile_vertices = tiles_vertices[tile_index++];
+
+		for (const Vector<int> &tile_polygon : E.value.polygons) {
+			LocalVector<int> nav_indices;
+
+			const auto push_index = [&nav_indices](int p_index) {
+				if (nav_indices.is_empty() || nav_indices[nav_indices.size() - 1] != p_index) {
+					nav_indices.push_back(p_index);
+				}
+			};
+
+			for (int i = 0; i < tile_polygon.size(); i++) {
+				const TileVertex &from = tile_vertices[tile_polygon[i]];
+				const TileVertex &to = tile_vertices[tile_polygon[(i + 1) % tile_polygon.size()]];
+				push_index(get_vertex_index(from.position));
+
+				for (int axis = 0; axis < 2; axis++) {
+					if (!from.on_seam[axis] || !to.on_seam[axis] || from.seam[axis] != to.seam[axis]) {
+						continue;
+					}
+
+					const LocalVector<SeamPoint> &seam_points = seams[axis][from.seam[axis]];
+					const real_t from_offset = from.position[seam_offset_coord[axis]];
+					const real_t to_offset = to.position[seam_offset_coord[axis]];
+
+					// Only the seam points at the height of the edge split it.
+					const auto is_on_edge = [&from, &to, from_offset, to_offset, p_seam_height](const SeamPoint &p_seam_point) -> bool {
+						const real_t weight = (p_seam_point.offset - from_offset) / (to_offset - from_offset);
+						return Math::abs(p_seam_point.position.y - Math::lerp(from.position.y, to.position.y, weight)) < p_seam_height;
+					};
+
+					if (from_offset < to_offset) {
+						for (uint32_t j = find_seam_point(seam_points, from_offset + seam_epsilon); j < seam_points.size() && seam_points[j].offset < to_offset - seam_epsilon; j++) {
+							if (is_on_edge(seam_points[j])) {
+								push_index(get_vertex_index(seam_points[j].position));
+							}
+						}
+					} else {
+						const uint32_t first = find_seam_point(seam_points, to_offset + seam_epsilon);
+						uint32_t last = first;
+						while (last < seam_points.size() && seam_points[last].offset < from_offset - seam_epsilon) {
+							last++;
+						}
+						for (uint32_t j = last; j > first; j--) {
+							if (is_on_edge(seam_points[j - 1])) {
+								push_index(get_vertex_index(seam_points[j - 1].position));
+							}
+						}
+					}
+					break;
+				}
+			}
+
+			if (nav_indices.size() > 1 && nav_indices[0] == nav_indices[nav_indices.size() - 1]) {
+				nav_indices.remove_at(nav_indices.size() - 1);
+			}
+			if (nav_indices.size() >= 3) {
+				r_polygons.push_back(nav_indices);
+			}
+		}
+	}
+
+	r_vertices = nav_vertices;
+}
+
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
 	ERR_FAIL_COND_V(!p_callback.is_valid(), false);
 
@@ -44,6 +44,7 @@ class NavMeshGenerator3D : public Object {
 
 	static Mutex baking_navmesh_mutex;
 	static Mutex generator_task_mutex;
+	static Mutex tile_cache_mutex;
 
 	static RWLock generator_parsers_rwlock;
 	static LocalVector<NavMeshGeometryParser3D *> generator_parsers;
@@ -71,6 +72,28 @@ public:
 	};
 
 private:
+	struct NavMeshTile3D {
+		// Hash of the bake settings and of all source geometry that touches the tile including its border.
+		uint32_t source_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct NavMeshTileCache3D {
+		real_t tile_size = 0.0;
+		HashMap<Vector2i, NavMeshTile3D> tiles;
+		uint32_t last_rebaked_tile_count = 0;
+		// The cache map holds one reference and every bake using the tiles another, guarded by the tile cache mutex.
+		uint32_t reference_count = 1;
+	};
+
+	struct NavMeshTileBake3D {
+		Vector2i coords;
+		uint32_t source_hash = 0;
+		Ref<NavigationMesh> navigation_mesh;
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry_data;
+	};
+
 	struct NavMeshGeneratorTask3D {
 		enum TaskStatus {
 			BAKING_STARTED,
@@ -87,6 +110,10 @@ private:
 		NavMeshGeneratorTask3D::TaskStatus status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 
 		NavMeshBakeState bake_state = NavMeshBakeState::BAKE_STATE_NONE;
+
+		// When above zero the navigation mesh is baked as a grid of tiles with this size.
+		real_t tile_size = 0.0;
+		LocalVector<NavMeshTileBake3D> tile_bakes;
 	};
 
 	static HashMap<WorkerThreadPool::TaskID, NavMeshGeneratorTask3D *> generator_tasks;
@@ -95,9 +122,21 @@ private:
 
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static void generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static void generator_thread_bake_tile(void *p_arg, uint32_t p_index);
+	static void generator_stitch_tiles(const NavMeshTileCache3D *p_tile_cache, real_t p_cell_size, real_t p_seam_height, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+	static NavMeshTileCache3D *generator_acquire_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh, real_t p_tile_size);
+	static void generator_release_tile_cache(NavMeshTileCache3D *p_tile_cache);
+	static void generator_unreference_tile_cache(NavMeshTileCache3D *p_tile_cache);
+	static void generator_erase_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh);
+
+	static void generator_bake(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback);
+	static void generator_bake_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -113,8 +152,12 @@ public:
 	static void parse_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
+	static void bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback = Callable());
+	static void bake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 	static String get_baking_state_msg(Ref<NavigationMesh> p_navigation_mesh);
+	// Number of tiles rebaked by the last tiled bake of the navigation mesh.
+	static uint32_t get_last_rebaked_tile_count(Ref<NavigationMesh> p_navigation_mesh);
 
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
@@ -284,6 +284,9 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	if (!owner_is_usable) {
 		return;
 	}
+	if (p_query_task.use_hierarchy_corridor && !p_query_task.hierarchy_corridor.has(connection_owner)) {
+		return;
+	}
 
 	Heap<NavigationPoly *, NavPolyTravelCostGreaterThan, NavPolyHeapIndexer>
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
@@ -317,6 +320,102 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
+void NavMeshQueries3D::_query_task_build_hierarchy_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	p_query_task.hierarchy_corridor.clear();
+	p_query_task.use_hierarchy_corridor = false;
+
+	const NavBaseIteration3D *begin_navbase = p_query_task.begin_polygon->owner;
+	const NavBaseIteration3D *end_navbase = p_query_task.end_polygon->owner;
+	if (begin_navbase == end_navbase) {
+		return;
+	}
+
+	const LocalVector<Portal> &portals = p_map_iteration.portals;
+	const HashMap<const NavBaseIteration3D *, LocalVector<uint32_t>> &navbases_portals = p_map_iteration.navbases_portals;
+
+	HashMap<const NavBaseIteration3D *, LocalVector<uint32_t>>::ConstIterator begin_portals = navbases_portals.find(begin_navbase);
+	if (!begin_portals) {
+		return;
+	}
+
+	Heap<NavigationPortal *, NavPortalTravelCostGreaterThan, NavPortalHeapIndexer>
+			&traversable_portals = p_query_task.path_query_slot->traversable_portals;
+	traversable_portals.clear();
+
+	LocalVector<NavigationPortal> &navigation_portals = p_query_task.path_query_slot->portal_corridor;
+	ERR_FAIL_COND(navigation_portals.size() != portals.size());
+	for (NavigationPortal &navigation_portal : navigation_portals) {
+		navigation_portal.reset();
+	}
+
+	const Vector3 &begin_point = p_query_task.begin_position;
+	const Vector3 &end_point = p_query_task.end_position;
+
+	for (uint32_t portal_id : begin_portals->value) {
+		const Portal &portal = portals[portal_id];
+		if (!_query_task_is_connection_owner_usable(p_query_task, portal.to)) {
+			continue;
+		}
+
+		NavigationPortal &navigation_portal = navigation_portals[portal_id];
+		navigation_portal.traveled_distance = begin_point.distance_to(portal.position) * begin_navbase->get_travel_cost() + portal.to->get_enter_cost();
+		navigation_portal.distance_to_destination = portal.position.distance_to(end_point) * portal.to->get_travel_cost();
+		traversable_portals.push(&navigation_portal);
+	}
+
+	// This is an implementation of the A* algorithm over the portals, where the cost
+	// of crossing a cluster is the straight distance between its portals.
+	int end_portal_id = -1;
+	while (!traversable_portals.is_empty()) {
+		const NavigationPortal *least_cost_portal = traversable_portals.pop();
+		const uint32_t least_cost_id = least_cost_portal - navigation_portals.ptr();
+		const Portal &least_cost = portals[least_cost_id];
+
+		if (least_cost.to == end_navbase) {
+			end_portal_id = least_cost_id;
+			break;
+		}
+
+		HashMap<const NavBaseIteration3D *, LocalVector<uint32_t>>::ConstIterator next_portals = navbases_portals.find(least_cost.to);
+		if (!next_portals) {
+			continue;
+		}
+
+		for (uint32_t portal_id : next_portals->value) {
+			const Portal &portal = portals[portal_id];
+			if (!_query_task_is_connection_owner_usable(p_query_task, portal.to)) {
+				continue;
+			}
+
+			const real_t new_traveled_distance = least_cost_portal->traveled_distance + least_cost.position.distance_to(portal.position) * least_cost.to->get_travel_cost() + portal.to->get_enter_cost();
+
+			NavigationPortal &navigation_portal = navigation_portals[portal_id];
+			if (new_traveled_distance < navigation_portal.traveled_distance) {
+				navigation_portal.back_portal_id = least_cost_id;
+				navigation_portal.traveled_distance = new_traveled_distance;
+				navigation_portal.distance_to_destination = portal.position.distance_to(end_point) * portal.to->get_travel_cost();
+
+				if (navigation_portal.traversable_portal_index != traversable_portals.INVALID_INDEX) {
+					traversable_portals.shift(navigation_portal.traversable_portal_index);
+				} else {
+					traversable_portals.push(&navigation_portal);
+				}
+			}
+		}
+	}
+
+	if (end_portal_id < 0) {
+		// No abstract path, let the polygon search find the closest reachable point.
+		return;
+	}
+
+	p_query_task.hierarchy_corridor.insert(begin_navbase);
+	for (int portal_id = end_portal_id; portal_id >= 0; portal_id = navigation_portals[portal_id].back_portal_id) {
+		p_query_task.hierarchy_corridor.insert(portals[portal_id].to);
+	}
+	p_query_task.use_hierarchy_corridor = true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
@@ -364,7 +463,17 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 
 	bool has_path_search_max = p_query_task.path_search_max_polygons > 0 || path_search_max_distance_sqr > 0.0;
 
-	while (true) {
+	if (p_query_task.path_cache_route && p_query_task.path_cache_route->has(begin_poly)) {
+		// The begin polygon is already part of a cached route towards the end polygon.
+		least_cost_id = _query_task_follow_path_cache_route(p_query_task, least_cost_id);
+		found_route = navigation_polys[least_cost_id].poly == end_poly;
+		if (!found_route) {
+			p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED;
+			ERR_FAIL_MSG("Navigation path cache route doesn't lead to the end polygon.");
+		}
+	}
+
+	while (!found_route) {
 		const NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 
 		const NavBaseIteration3D *least_cost_navbase = least_cost_poly.poly->owner;
@@ -398,6 +507,25 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		}
 
 		poly_enter_cost = 0;
+
+		if (traversable_polys.is_empty() && p_query_task.use_hierarchy_corridor && !path_search_max_reached) {
+			// The end polygon can't be reached through the clusters of the abstract path,
+			// restart the search on the whole map.
+			p_query_task.use_hierarchy_corridor = false;
+
+			for (NavigationPoly &nav_poly : navigation_polys) {
+				nav_poly.poly = nullptr;
+				nav_poly.traveled_distance = FLT_MAX;
+			}
+			least_cost_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
+			navigation_polys[least_cost_id].poly = begin_poly;
+			navigation_polys[least_cost_id].traveled_distance = 0;
+			reachable_end = nullptr;
+			distance_to_reachable_end = FLT_MAX;
+			processed_polygon_count = 0;
+			continue;
+		}
+
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
@@ -475,6 +603,17 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				break;
 			}
 
+			// Check if we reached a cached route towards the end, the rest of the path is already known.
+			if (is_reachable && p_query_task.path_cache_route && p_query_task.path_cache_route->has(navigation_polys[least_cost_id].poly)) {
+				least_cost_id = _query_task_follow_path_cache_route(p_query_task, least_cost_id);
+				found_route = navigation_polys[least_cost_id].poly == end_poly;
+				if (!found_route) {
+					p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED;
+					ERR_FAIL_MSG("Navigation path cache route doesn't lead to the end polygon.");
+				}
+				break;
+			}
+
 			if (navigation_polys[least_cost_id].poly->owner->get_self() != least_cost_poly.poly->owner->get_self()) {
 				ERR_FAIL_NULL(least_cost_poly.poly->owner);
 				poly_enter_cost = least_cost_poly.poly->owner->get_enter_cost();
@@ -512,6 +651,68 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	}
 }
 
+uint32_t NavMeshQueries3D::_query_task_follow_path_cache_route(NavMeshPathQueryTask3D &p_query_task, uint32_t p_from_id) {
+	const AHashMap<const Polygon *, PathCacheHop> &path_cache_route = *p_query_task.path_cache_route;
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+	AHashMap<const Polygon *, uint32_t> &poly_to_id = p_query_task.path_query_slot->poly_to_id;
+
+	uint32_t from_id = p_from_id;
+	// A route never visits a polygon twice, the hop limit only guards against a broken cache.
+	for (uint32_t hop_count = 0; hop_count < navigation_polys.size(); hop_count++) {
+		const NavigationPoly &from_poly = navigation_polys[from_id];
+		if (from_poly.poly == p_query_task.end_polygon) {
+			break;
+		}
+
+		const PathCacheHop *hop = path_cache_route.getptr(from_poly.poly);
+		ERR_FAIL_NULL_V(hop, from_id);
+
+		const uint32_t to_id = poly_to_id[hop->polygon];
+		NavigationPoly &to_poly = navigation_polys[to_id];
+		to_poly.poly = hop->polygon;
+		to_poly.back_navigation_poly_id = from_id;
+		to_poly.back_navigation_edge = hop->edge;
+		to_poly.back_navigation_edge_pathway_start = hop->pathway_start;
+		to_poly.back_navigation_edge_pathway_end = hop->pathway_end;
+		to_poly.entry = Geometry3D::get_closest_point_to_segment(from_poly.entry, hop->pathway_start, hop->pathway_end);
+		to_poly.traveled_distance = from_poly.traveled_distance + from_poly.entry.distance_to(to_poly.entry);
+
+		from_id = to_id;
+	}
+
+	return from_id;
+}
+
+void NavMeshQueries3D::_query_task_store_path_cache_route(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCacheKey &p_path_cache_key) {
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	p_map_iteration.path_cache_rwlock.write_lock();
+
+	HashMap<PathCacheKey, AHashMap<const Polygon *, PathCacheHop>, PathCacheKey>::Iterator path_cache_route = p_map_iteration.path_cache.find(p_path_cache_key);
+	if (!path_cache_route) {
+		if (p_map_iteration.path_cache.size() >= NavMapIteration3D::PATH_CACHE_MAX_ROUTES) {
+			// Start over rather than track which routes are still in use.
+			p_map_iteration.path_cache.clear();
+		}
+		path_cache_route = p_map_iteration.path_cache.insert(p_path_cache_key, AHashMap<const Polygon *, PathCacheHop>());
+	}
+
+	// Overwrite the hops of every polygon along the path, so that all of them lead to the end polygon
+	// without cycles even if another query stored a different route through some of them meanwhile.
+	for (int np_id = p_query_task.least_cost_id; navigation_polys[np_id].back_navigation_poly_id != -1; np_id = navigation_polys[np_id].back_navigation_poly_id) {
+		const NavigationPoly &navigation_poly = navigation_polys[np_id];
+
+		PathCacheHop hop;
+		hop.polygon = navigation_poly.poly;
+		hop.edge = navigation_poly.back_navigation_edge;
+		hop.pathway_start = navigation_poly.back_navigation_edge_pathway_start;
+		hop.pathway_end = navigation_poly.back_navigation_edge_pathway_end;
+		path_cache_route->value[navigation_polys[navigation_poly.back_navigation_poly_id].poly] = hop;
+	}
+
+	p_map_iteration.path_cache_rwlock.write_unlock();
+}
+
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	p_query_task.path_clear();
 
@@ -531,8 +732,34 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
+	// Queries that filter regions can't share routes with other queries.
+	const bool use_path_cache = p_map_iteration.use_path_cache && !p_query_task.exclude_regions && !p_query_task.include_regions;
+	PathCacheKey path_cache_key;
+	path_cache_key.end_polygon = p_query_task.end_polygon;
+	path_cache_key.navigation_layers = p_query_task.navigation_layers;
+
+	if (use_path_cache) {
+		p_map_iteration.path_cache_rwlock.read_lock();
+		p_query_task.path_cache_route = p_map_iteration.path_cache.getptr(path_cache_key);
+	}
+
+	const bool has_cached_route = p_query_task.path_cache_route && p_query_task.path_cache_route->has(p_query_task.begin_polygon);
+	if (!p_map_iteration.portals.is_empty() && !has_cached_route) {
+		_query_task_build_hierarchy_corridor(p_query_task, p_map_iteration);
+	}
+
 	_query_task_build_path_corridor(p_query_task, p_map_iteration);
 
+	if (use_path_cache) {
+		p_query_task.path_cache_route = nullptr;
+		p_map_iteration.path_cache_rwlock.read_unlock();
+
+		// Only store complete routes, not the ones that ended at the closest reachable polygon.
+		if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED && p_query_task.end_polygon == path_cache_key.end_polygon && !has_cached_route) {
+			_query_task_store_path_cache_route(p_query_task, p_map_iteration, path_cache_key);
+		}
+	}
+
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
 		return;
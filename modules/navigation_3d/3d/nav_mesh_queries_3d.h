@@ -33,6 +33,7 @@
 #include "../nav_utils_3d.h"
 
 #include "core/templates/a_hash_map.h"
+#include "core/templates/hash_set.h"
 
 #include "servers/navigation/navigation_globals.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
@@ -52,6 +53,10 @@ public:
 		bool in_use = false;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
+
+		// Hierarchical path queries, indexed like the portals of the map iteration.
+		LocalVector<Nav3D::NavigationPortal> portal_corridor;
+		Heap<Nav3D::NavigationPortal *, Nav3D::NavPortalTravelCostGreaterThan, Nav3D::NavPortalHeapIndexer> traversable_portals;
 	};
 
 	struct NavMeshPathQueryTask3D {
@@ -90,6 +95,14 @@ public:
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
 
+		// Navigation regions and links along the abstract path of hierarchical path queries,
+		// the polygon search is restricted to them while the corridor is used.
+		HashSet<const NavBaseIteration3D *> hierarchy_corridor;
+		bool use_hierarchy_corridor = false;
+
+		// Cached route tree towards the end polygon, read locked while the path corridor is built.
+		const AHashMap<const Nav3D::Polygon *, Nav3D::PathCacheHop> *path_cache_route = nullptr;
+
 		// Map.
 		Vector3 map_up;
 		NavMap3D *map = nullptr;
@@ -144,7 +157,10 @@ public:
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void _query_task_build_hierarchy_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static uint32_t _query_task_follow_path_cache_route(NavMeshPathQueryTask3D &p_query_task, uint32_t p_from_id);
+	static void _query_task_store_path_cache_route(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCacheKey &p_path_cache_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
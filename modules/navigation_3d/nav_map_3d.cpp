@@ -110,6 +110,22 @@ void NavMap3D::set_use_edge_connections(bool p_enabled) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	iteration_dirty = true;
+}
+
+void NavMap3D::set_use_path_cache(bool p_enabled) {
+	if (use_path_cache == p_enabled) {
+		return;
+	}
+	use_path_cache = p_enabled;
+	iteration_dirty = true;
+}
+
 void NavMap3D::set_edge_connection_margin(real_t p_edge_connection_margin) {
 	if (edge_connection_margin == p_edge_connection_margin) {
 		return;
@@ -366,6 +382,8 @@ void NavMap3D::_build_iteration() {
 
 	iteration_build.merge_rasterizer_cell_size = get_merge_rasterizer_cell_size();
 	iteration_build.use_edge_connections = get_use_edge_connections();
+	iteration_build.use_hierarchical_pathfinding = get_use_hierarchical_pathfinding();
+	iteration_build.use_path_cache = get_use_path_cache();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
 
@@ -473,10 +491,14 @@ void NavMap3D::sync() {
 void NavMap3D::_sync_avoidance() {
 	_sync_dirty_avoidance_update_requests();
 
+	const uint64_t avoidance_sync_begin_usec = OS::get_singleton()->get_ticks_usec();
+
 	if (obstacles_dirty || agents_dirty) {
 		_update_rvo_simulation();
 	}
 
+	avoidance_sync_usec = OS::get_singleton()->get_ticks_usec() - avoidance_sync_begin_usec;
+
 	obstacles_dirty = false;
 	agents_dirty = false;
 }
@@ -563,6 +585,18 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 }
 
 void NavMap3D::_update_rvo_agents_tree_2d() {
+	if (avoidance_use_uniform_grid) {
+		real_t neighbor_distance_max = 0.0;
+		avoidance_grid_positions.resize(active_2d_avoidance_agents.size());
+		for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+			const RVO2D::Agent2D *rvo_agent = active_2d_avoidance_agents[i]->get_rvo_agent_2d();
+			avoidance_grid_positions[i] = Vector3(rvo_agent->position_.x(), 0.0, rvo_agent->position_.y());
+			neighbor_distance_max = MAX(neighbor_distance_max, rvo_agent->neighborDist_);
+		}
+		avoidance_grid_2d.build(avoidance_grid_positions, neighbor_distance_max, false);
+		return;
+	}
+
 	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
 	std::vector<RVO2D::Agent2D *> raw_agents;
 	raw_agents.reserve(active_2d_avoidance_agents.size());
@@ -573,6 +607,18 @@ void NavMap3D::_update_rvo_agents_tree_2d() {
 }
 
 void NavMap3D::_update_rvo_agents_tree_3d() {
+	if (avoidance_use_uniform_grid) {
+		real_t neighbor_distance_max = 0.0;
+		avoidance_grid_positions.resize(active_3d_avoidance_agents.size());
+		for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+			const RVO3D::Agent3D *rvo_agent = active_3d_avoidance_agents[i]->get_rvo_agent_3d();
+			avoidance_grid_positions[i] = Vector3(rvo_agent->position_.x(), rvo_agent->position_.y(), rvo_agent->position_.z());
+			neighbor_distance_max = MAX(neighbor_distance_max, rvo_agent->neighborDist_);
+		}
+		avoidance_grid_3d.build(avoidance_grid_positions, neighbor_distance_max, true);
+		return;
+	}
+
 	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
 	std::vector<RVO3D::Agent3D *> raw_agents;
 	raw_agents.reserve(active_3d_avoidance_agents.size());
@@ -593,50 +639,95 @@ void NavMap3D::_update_rvo_simulation() {
 }
 
 void NavMap3D::compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-	(*(agent + index))->update();
+	RVO2D::Agent2D *rvo_agent = (*(agent + index))->get_rvo_agent_2d();
+	if (avoidance_use_uniform_grid) {
+		_compute_rvo_agent_neighbors_grid_2d(rvo_agent);
+	} else {
+		rvo_agent->computeNeighbors(&rvo_simulation_2d);
+	}
+	rvo_agent->computeNewVelocity(&rvo_simulation_2d);
 }
 
 void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-	(*(agent + index))->update();
+	RVO3D::Agent3D *rvo_agent = (*(agent + index))->get_rvo_agent_3d();
+	if (avoidance_use_uniform_grid) {
+		_compute_rvo_agent_neighbors_grid_3d(rvo_agent);
+	} else {
+		rvo_agent->computeNeighbors(&rvo_simulation_3d);
+	}
+	rvo_agent->computeNewVelocity(&rvo_simulation_3d);
+}
+
+void NavMap3D::_compute_rvo_agent_neighbors_grid_2d(RVO2D::Agent2D *p_rvo_agent) {
+	// Same as RVO2D::Agent2D::computeNeighbors() but with the agent neighbors from the grid.
+	p_rvo_agent->obstacleNeighbors_.clear();
+	float range_sq = RVO2D::sqr(p_rvo_agent->timeHorizonObst_ * p_rvo_agent->maxSpeed_ + p_rvo_agent->radius_);
+	rvo_simulation_2d.kdTree_->computeObstacleNeighbors(p_rvo_agent, range_sq);
+
+	p_rvo_agent->agentNeighbors_.clear();
+	if (p_rvo_agent->maxNeighbors_ > 0) {
+		range_sq = RVO2D::sqr(p_rvo_agent->neighborDist_);
+		const Vector3 position = Vector3(p_rvo_agent->position_.x(), 0.0, p_rvo_agent->position_.y());
+		avoidance_grid_2d.query(position, range_sq, [&](uint32_t p_agent_index) {
+			p_rvo_agent->insertAgentNeighbor(active_2d_avoidance_agents[p_agent_index]->get_rvo_agent_2d(), range_sq);
+		});
+	}
+}
+
+void NavMap3D::_compute_rvo_agent_neighbors_grid_3d(RVO3D::Agent3D *p_rvo_agent) {
+	// Same as RVO3D::Agent3D::computeNeighbors() but with the agent neighbors from the grid.
+	p_rvo_agent->agentNeighbors_.clear();
+	if (p_rvo_agent->maxNeighbors_ > 0) {
+		float range_sq = p_rvo_agent->neighborDist_ * p_rvo_agent->neighborDist_;
+		const Vector3 position = Vector3(p_rvo_agent->position_.x(), p_rvo_agent->position_.y(), p_rvo_agent->position_.z());
+		avoidance_grid_3d.query(position, range_sq, [&](uint32_t p_agent_index) {
+			p_rvo_agent->insertAgentNeighbor(active_3d_avoidance_agents[p_agent_index]->get_rvo_agent_3d(), range_sq);
+		});
+	}
 }
 
 void NavMap3D::step(double p_delta_time) {
+	const uint64_t avoidance_step_begin_usec = OS::get_singleton()->get_ticks_usec();
+
 	rvo_simulation_2d.setTimeStep(float(p_delta_time));
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
+	// All agents compute their new velocity before any of them moves, so the agents that run
+	// in parallel never read the velocity and position of a neighbor that is being updated.
+
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
+			for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+				compute_single_avoidance_step_2d(i, active_2d_avoidance_agents.ptr());
 			}
 		}
+
+		for (NavAgent3D *agent : active_2d_avoidance_agents) {
+			agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+			agent->update();
+		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, avoidance_use_high_priority_threads, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
+			for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+				compute_single_avoidance_step_3d(i, active_3d_avoidance_agents.ptr());
 			}
 		}
+
+		for (NavAgent3D *agent : active_3d_avoidance_agents) {
+			agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+			agent->update();
+		}
 	}
+
+	performance_data.pm_avoidance_time_usec = avoidance_sync_usec + (OS::get_singleton()->get_ticks_usec() - avoidance_step_begin_usec);
 }
 
 void NavMap3D::dispatch_callbacks() {
@@ -855,6 +946,7 @@ bool NavMap3D::get_use_async_iterations() const {
 NavMap3D::NavMap3D() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
+	avoidance_use_uniform_grid = GLOBAL_GET("navigation/avoidance/neighbor_search/use_uniform_grid");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
 
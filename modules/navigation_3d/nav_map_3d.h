@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "3d/nav_avoidance_grid_3d.h"
 #include "3d/nav_map_iteration_3d.h"
 #include "3d/nav_mesh_queries_3d.h"
 #include "nav_rid_3d.h"
@@ -71,6 +72,12 @@ class NavMap3D : public NavRid3D {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = NavigationDefaults3D::LINK_CONNECTION_RADIUS;
 
+	/// Path queries first search an abstract graph of the regions and links.
+	bool use_hierarchical_pathfinding = false;
+
+	/// Path queries reuse the routes of earlier queries to the same target polygon.
+	bool use_path_cache = false;
+
 	bool map_settings_dirty = true;
 
 	/// Map regions
@@ -106,6 +113,15 @@ class NavMap3D : public NavRid3D {
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
 
+	/// Avoidance agents find their neighbors with a uniform grid instead of the RVO KdTree.
+	bool avoidance_use_uniform_grid = false;
+	NavAvoidanceGrid3D avoidance_grid_2d;
+	NavAvoidanceGrid3D avoidance_grid_3d;
+	LocalVector<Vector3> avoidance_grid_positions;
+
+	/// Time spent on the avoidance agent trees during the last sync.
+	uint64_t avoidance_sync_usec = 0;
+
 	// Performance Monitor
 	Nav3D::PerformanceData performance_data;
 
@@ -193,6 +209,16 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
+	void set_use_path_cache(bool p_enabled);
+	bool get_use_path_cache() const {
+		return use_path_cache;
+	}
+
 	Nav3D::PointKey get_point_key(const Vector3 &p_pos) const;
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
@@ -249,6 +275,7 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	uint64_t get_pm_avoidance_time_usec() const { return performance_data.pm_avoidance_time_usec; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -279,6 +306,8 @@ private:
 
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
+	void _compute_rvo_agent_neighbors_grid_2d(RVO2D::Agent2D *p_rvo_agent);
+	void _compute_rvo_agent_neighbors_grid_3d(RVO3D::Agent3D *p_rvo_agent);
 
 	void _sync_avoidance();
 	void _update_rvo_simulation();
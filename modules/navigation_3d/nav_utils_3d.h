@@ -171,6 +171,86 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+/// Aggregates the external connections leading from one navigation region or link to another.
+/// Portals are the nodes of the abstract graph used by hierarchical path queries.
+struct Portal {
+	const NavBaseIteration3D *from = nullptr;
+	const NavBaseIteration3D *to = nullptr;
+
+	/// Average of the pathway centers of the aggregated connections.
+	Vector3 position;
+};
+
+struct NavigationPortal {
+	/// Index in the heap of traversable portals.
+	uint32_t traversable_portal_index = UINT32_MAX;
+
+	/// The portal this portal was reached from, used to travel the path backwards.
+	int back_portal_id = -1;
+
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = 0.0;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_portal_index = UINT32_MAX;
+		back_portal_id = -1;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+	}
+};
+
+struct NavPortalTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationPortal *p_portal_a, const NavigationPortal *p_portal_b) const {
+		real_t f_cost_a = p_portal_a->total_travel_cost();
+		real_t f_cost_b = p_portal_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_portal_a->distance_to_destination > p_portal_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavPortalHeapIndexer {
+	void operator()(NavigationPortal *p_portal, uint32_t p_heap_index) const {
+		p_portal->traversable_portal_index = p_heap_index;
+	}
+};
+
+struct PathCacheKey {
+	const Polygon *end_polygon = nullptr;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const PathCacheKey &p_val) {
+		return hash_murmur3_one_32(p_val.navigation_layers, hash_one_uint64((uint64_t)p_val.end_polygon));
+	}
+
+	bool operator==(const PathCacheKey &p_key) const {
+		return end_polygon == p_key.end_polygon && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+struct PathCacheHop {
+	/// The next polygon towards the end polygon of the cached route.
+	const Polygon *polygon = nullptr;
+
+	/// Edge crossed to enter the next polygon, see `NavigationPoly::back_navigation_edge`.
+	int edge = -1;
+
+	/// Pathway crossed to enter the next polygon.
+	Vector3 pathway_start;
+	Vector3 pathway_end;
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -192,6 +272,7 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	uint64_t pm_avoidance_time_usec = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -203,6 +284,7 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_avoidance_time_usec = 0;
 	}
 };
 
@@ -0,0 +1,338 @@
+/**************************************************************************/
+/*  animation_texture_baker.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "animation_texture_baker.h"
+
+#include "scene/3d/skeleton_3d.h"
+
+static _FORCE_INLINE_ Transform3D _texels_to_transform(const float *p_texels) {
+	Transform3D xform;
+	for (int i = 0; i < 3; i++) {
+		xform.basis.rows[i][0] = p_texels[i * 4 + 0];
+		xform.basis.rows[i][1] = p_texels[i * 4 + 1];
+		xform.basis.rows[i][2] = p_texels[i * 4 + 2];
+		xform.origin[i] = p_texels[i * 4 + 3];
+	}
+	return xform;
+}
+
+void AnimationTextureBaker::set_fps(double p_fps) {
+	ERR_FAIL_COND_MSG(p_fps <= 0.0, "The baking frame rate must be greater than zero.");
+	fps = p_fps;
+}
+
+double AnimationTextureBaker::get_fps() const {
+	return fps;
+}
+
+int AnimationTextureBaker::get_frame_count(const Ref<Animation> &p_animation) const {
+	ERR_FAIL_COND_V(p_animation.is_null(), 0);
+	return int(Math::ceil(p_animation->get_length() * fps - CMP_EPSILON)) + 1;
+}
+
+Ref<Image> AnimationTextureBaker::bake_bone_texture(Skeleton3D *p_skeleton, const Ref<Skin> &p_skin, const Ref<Animation> &p_animation, Node *p_root_node) const {
+	ERR_FAIL_NULL_V(p_skeleton, Ref<Image>());
+	ERR_FAIL_COND_V(p_animation.is_null(), Ref<Image>());
+
+	const int bone_count = p_skeleton->get_bone_count();
+	ERR_FAIL_COND_V_MSG(bone_count == 0, Ref<Image>(), "The skeleton has no bones to bake.");
+
+	Ref<Skin> skin = p_skin;
+	if (skin.is_null()) {
+		skin = p_skeleton->create_skin_from_rest_transforms();
+	}
+
+	const int bind_count = skin->get_bind_count();
+	const int frame_count = get_frame_count(p_animation);
+	ERR_FAIL_COND_V_MSG(bind_count == 0, Ref<Image>(), "The skin has no binds to bake.");
+	ERR_FAIL_COND_V_MSG(bind_count * BONE_TEXELS > MAX_TEXTURE_SIZE, Ref<Image>(), vformat("Baking %d binds needs a texture wider than %d pixels.", bind_count, MAX_TEXTURE_SIZE));
+	ERR_FAIL_COND_V_MSG(frame_count > MAX_TEXTURE_SIZE, Ref<Image>(), vformat("Baking %d frames needs a texture taller than %d pixels, lower the frame rate.", frame_count, MAX_TEXTURE_SIZE));
+
+	// Resolve binds the same way Skeleton3D does when it registers a skin.
+	LocalVector<int> bind_bones;
+	bind_bones.resize(bind_count);
+	for (int i = 0; i < bind_count; i++) {
+		StringName bind_name = skin->get_bind_name(i);
+		int bone = bind_name != StringName() ? p_skeleton->find_bone(bind_name) : skin->get_bind_bone(i);
+		ERR_FAIL_INDEX_V_MSG(bone, bone_count, Ref<Image>(), "Skin bind #" + itos(i) + " does not match any bone of the skeleton.");
+		bind_bones[i] = bone;
+	}
+
+	// Parents must be evaluated before their children.
+	LocalVector<int> bone_order;
+	bone_order.reserve(bone_count);
+	for (int bone : p_skeleton->get_parentless_bones()) {
+		bone_order.push_back(bone);
+	}
+	for (uint32_t i = 0; i < bone_order.size(); i++) {
+		for (int child : p_skeleton->get_bone_children(bone_order[i])) {
+			bone_order.push_back(child);
+		}
+	}
+
+	struct BoneTrack {
+		int track = -1;
+		int bone = -1;
+		Animation::TrackType type = Animation::TYPE_POSITION_3D;
+	};
+
+	// Track paths are relative to the root node of the AnimationMixer, which is usually the parent of the skeleton.
+	Node *root_node = p_root_node ? p_root_node : p_skeleton->get_parent();
+
+	LocalVector<BoneTrack> bone_tracks;
+	for (int i = 0; i < p_animation->get_track_count(); i++) {
+		Animation::TrackType type = p_animation->track_get_type(i);
+		if (!p_animation->track_is_enabled(i) || (type != Animation::TYPE_POSITION_3D && type != Animation::TYPE_ROTATION_3D && type != Animation::TYPE_SCALE_3D)) {
+			continue;
+		}
+		NodePath path = p_animation->track_get_path(i);
+		if (path.get_subname_count() != 1) {
+			continue;
+		}
+		if (root_node) {
+			if (root_node->get_node_or_null(NodePath(path.get_names(), path.is_absolute())) != p_skeleton) {
+				continue;
+			}
+		} else if (path.get_name_count() != 1 || path.get_name(0) != p_skeleton->get_name()) {
+			continue;
+		}
+		BoneTrack bone_track;
+		bone_track.track = i;
+		bone_track.bone = p_skeleton->find_bone(path.get_concatenated_subnames());
+		bone_track.type = type;
+		if (bone_track.bone >= 0) {
+			bone_tracks.push_back(bone_track);
+		}
+	}
+
+	LocalVector<Vector3> positions;
+	LocalVector<Quaternion> rotations;
+	LocalVector<Vector3> scales;
+	LocalVector<Transform3D> global_poses;
+	positions.resize(bone_count);
+	rotations.resize(bone_count);
+	scales.resize(bone_count);
+	global_poses.resize(bone_count);
+
+	const int width = bind_count * BONE_TEXELS;
+	Vector<uint8_t> data;
+	data.resize(width * frame_count * 4 * sizeof(float));
+	float *dataptr = (float *)data.ptrw();
+
+	for (int frame = 0; frame < frame_count; frame++) {
+		double time = MIN(frame / fps, p_animation->get_length());
+
+		// Bones without tracks keep their current pose, like they would with an AnimationMixer.
+		for (int i = 0; i < bone_count; i++) {
+			positions[i] = p_skeleton->get_bone_pose_position(i);
+			rotations[i] = p_skeleton->get_bone_pose_rotation(i);
+			scales[i] = p_skeleton->get_bone_pose_scale(i);
+		}
+
+		for (const BoneTrack &bone_track : bone_tracks) {
+			switch (bone_track.type) {
+				case Animation::TYPE_POSITION_3D: {
+					p_animation->try_position_track_interpolate(bone_track.track, time, &positions[bone_track.bone]);
+				} break;
+				case Animation::TYPE_ROTATION_3D: {
+					p_animation->try_rotation_track_interpolate(bone_track.track, time, &rotations[bone_track.bone]);
+				} break;
+				case Animation::TYPE_SCALE_3D: {
+					p_animation->try_scale_track_interpolate(bone_track.track, time, &scales[bone_track.bone]);
+				} break;
+				default: {
+				}
+			}
+		}
+
+		for (int bone : bone_order) {
+			Transform3D pose;
+			pose.basis.set_quaternion_scale(rotations[bone], scales[bone]);
+			pose.origin = positions[bone];
+			int parent = p_skeleton->get_bone_parent(bone);
+			global_poses[bone] = parent >= 0 ? global_poses[parent] * pose : pose;
+		}
+
+		for (int i = 0; i < bind_count; i++, dataptr += BONE_TEXELS * 4) {
+			Transform3D xform = global_poses[bind_bones[i]] * skin->get_bind_pose(i);
+			for (int j = 0; j < 3; j++) {
+				dataptr[j * 4 + 0] = xform.basis.rows[j][0];
+				dataptr[j * 4 + 1] = xform.basis.rows[j][1];
+				dataptr[j * 4 + 2] = xform.basis.rows[j][2];
+				dataptr[j * 4 + 3] = xform.origin[j];
+			}
+		}
+	}
+
+	return Image::create_from_data(width, frame_count, false, Image::FORMAT_RGBAF, data);
+}
+
+Ref<Image> AnimationTextureBaker::bake_vertex_texture(const Ref<Mesh> &p_mesh, int p_surface, const Ref<Image> &p_bone_texture, VertexData p_data) const {
+	ERR_FAIL_COND_V(p_mesh.is_null(), Ref<Image>());
+	ERR_FAIL_INDEX_V(p_surface, p_mesh->get_surface_count(), Ref<Image>());
+	ERR_FAIL_COND_V(p_bone_texture.is_null(), Ref<Image>());
+	ERR_FAIL_INDEX_V(p_data, VERTEX_DATA_MAX, Ref<Image>());
+	ERR_FAIL_COND_V_MSG(p_bone_texture->get_format() != Image::FORMAT_RGBAF || p_bone_texture->get_width() % BONE_TEXELS != 0, Ref<Image>(), "The bone texture must be baked with bake_bone_texture().");
+
+	const Array arrays = p_mesh->surface_get_arrays(p_surface);
+	const Vector<Vector3> vertices = arrays[Mesh::ARRAY_VERTEX];
+	const Vector<int> bones = arrays[Mesh::ARRAY_BONES];
+	const Vector<float> weights = arrays[Mesh::ARRAY_WEIGHTS];
+
+	const int vertex_count = vertices.size();
+	ERR_FAIL_COND_V_MSG(vertex_count == 0, Ref<Image>(), "The surface has no vertices to bake.");
+	ERR_FAIL_COND_V_MSG(vertex_count > MAX_TEXTURE_SIZE, Ref<Image>(), vformat("Baking %d vertices needs a texture wider than %d pixels.", vertex_count, MAX_TEXTURE_SIZE));
+	ERR_FAIL_COND_V_MSG(bones.is_empty() || bones.size() != weights.size() || bones.size() % vertex_count != 0, Ref<Image>(), "The surface must have bone and weight arrays.");
+
+	// Normals and tangents are directions, so only the basis of the skinning transforms applies to them, like when the rendering server skins meshes.
+	const Vector<Vector3> normals = arrays[Mesh::ARRAY_NORMAL];
+	const Vector<float> tangents = arrays[Mesh::ARRAY_TANGENT];
+	ERR_FAIL_COND_V_MSG(p_data == VERTEX_DATA_NORMAL && normals.size() != vertex_count, Ref<Image>(), "The surface has no normals to bake.");
+	ERR_FAIL_COND_V_MSG(p_data == VERTEX_DATA_TANGENT && tangents.size() != vertex_count * 4, Ref<Image>(), "The surface has no tangents to bake.");
+
+	const int bones_per_vertex = bones.size() / vertex_count;
+	const int bind_count = p_bone_texture->get_width() / BONE_TEXELS;
+	const int frame_count = p_bone_texture->get_height();
+	// Tangents keep the sign of their binormal in the alpha channel.
+	const int channels = p_data == VERTEX_DATA_TANGENT ? 4 : 3;
+
+	const Vector<uint8_t> bone_data = p_bone_texture->get_data();
+	const float *bone_texels = (const float *)bone_data.ptr();
+	const Vector3 *vertexptr = vertices.ptr();
+	const Vector3 *normalptr = normals.ptr();
+	const float *tangentptr = tangents.ptr();
+	const int *boneptr = bones.ptr();
+	const float *weightptr = weights.ptr();
+
+	Vector<uint8_t> data;
+	data.resize(vertex_count * frame_count * channels * sizeof(float));
+	float *dataptr = (float *)data.ptrw();
+
+	for (int frame = 0; frame < frame_count; frame++) {
+		const float *frame_texels = bone_texels + frame * bind_count * BONE_TEXELS * 4;
+		for (int i = 0; i < vertex_count; i++, dataptr += channels) {
+			Vector3 source;
+			switch (p_data) {
+				case VERTEX_DATA_POSITION: {
+					source = vertexptr[i];
+				} break;
+				case VERTEX_DATA_NORMAL: {
+					source = normalptr[i];
+				} break;
+				case VERTEX_DATA_TANGENT: {
+					source = Vector3(tangentptr[i * 4 + 0], tangentptr[i * 4 + 1], tangentptr[i * 4 + 2]);
+				} break;
+				default: {
+				}
+			}
+
+			Vector3 skinned;
+			for (int j = 0; j < bones_per_vertex; j++) {
+				float weight = weightptr[i * bones_per_vertex + j];
+				if (weight == 0.0) {
+					continue;
+				}
+				int bind = boneptr[i * bones_per_vertex + j];
+				ERR_FAIL_INDEX_V_MSG(bind, bind_count, Ref<Image>(), "Vertex #" + itos(i) + " uses a bone that is not in the bone texture.");
+				const Transform3D skinning = _texels_to_transform(frame_texels + bind * BONE_TEXELS * 4);
+				skinned += (p_data == VERTEX_DATA_POSITION ? skinning.xform(source) : skinning.basis.xform(source)) * weight;
+			}
+			if (p_data != VERTEX_DATA_POSITION) {
+				skinned.normalize();
+			}
+
+			dataptr[0] = skinned.x;
+			dataptr[1] = skinned.y;
+			dataptr[2] = skinned.z;
+			if (p_data == VERTEX_DATA_TANGENT) {
+				dataptr[3] = tangentptr[i * 4 + 3];
+			}
+		}
+	}
+
+	return Image::create_from_data(vertex_count, frame_count, false, p_data == VERTEX_DATA_TANGENT ? Image::FORMAT_RGBAF : Image::FORMAT_RGBF, data);
+}
+
+Transform3D AnimationTextureBaker::get_bone_texture_transform(const Ref<Image> &p_bone_texture, int p_frame, int p_bind) {
+	ERR_FAIL_COND_V(p_bone_texture.is_null(), Transform3D());
+	ERR_FAIL_COND_V(p_bone_texture->get_format() != Image::FORMAT_RGBAF, Transform3D());
+	ERR_FAIL_INDEX_V(p_frame, p_bone_texture->get_height(), Transform3D());
+	ERR_FAIL_INDEX_V(p_bind, p_bone_texture->get_width() / BONE_TEXELS, Transform3D());
+
+	const Vector<uint8_t> data = p_bone_texture->get_data();
+	const float *texels = (const float *)data.ptr();
+	return _texels_to_transform(texels + (p_frame * p_bone_texture->get_width() + p_bind * BONE_TEXELS) * 4);
+}
+
+Ref<Shader> AnimationTextureBaker::create_vertex_playback_shader() {
+	Ref<Shader> shader;
+	shader.instantiate();
+	shader->set_code(R"(
+// Plays vertex textures baked by AnimationTextureBaker on a MultiMeshInstance3D.
+// The frame of each instance is read from the red channel of its custom data,
+// and the fractional part blends with the next frame.
+
+shader_type spatial;
+
+uniform sampler2D vertex_positions : filter_nearest, repeat_disable;
+uniform sampler2D vertex_normals : filter_nearest, repeat_disable;
+
+void vertex() {
+	int frame_count = textureSize(vertex_positions, 0).y;
+	float frame = clamp(INSTANCE_CUSTOM.r, 0.0, float(frame_count - 1));
+	ivec2 from = ivec2(VERTEX_ID, int(frame));
+	ivec2 to = ivec2(VERTEX_ID, min(from.y + 1, frame_count - 1));
+	float weight = fract(frame);
+
+	VERTEX = mix(texelFetch(vertex_positions, from, 0).xyz, texelFetch(vertex_positions, to, 0).xyz, weight);
+	NORMAL = normalize(mix(texelFetch(vertex_normals, from, 0).xyz, texelFetch(vertex_normals, to, 0).xyz, weight));
+}
+)");
+	return shader;
+}
+
+void AnimationTextureBaker::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_fps", "fps"), &AnimationTextureBaker::set_fps);
+	ClassDB::bind_method(D_METHOD("get_fps"), &AnimationTextureBaker::get_fps);
+	ClassDB::bind_method(D_METHOD("get_frame_count", "animation"), &AnimationTextureBaker::get_frame_count);
+
+	ClassDB::bind_method(D_METHOD("bake_bone_texture", "skeleton", "skin", "animation", "root_node"), &AnimationTextureBaker::bake_bone_texture, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("bake_vertex_texture", "mesh", "surface", "bone_texture", "data"), &AnimationTextureBaker::bake_vertex_texture, DEFVAL(VERTEX_DATA_POSITION));
+
+	ClassDB::bind_static_method("AnimationTextureBaker", D_METHOD("get_bone_texture_transform", "bone_texture", "frame", "bind"), &AnimationTextureBaker::get_bone_texture_transform);
+	ClassDB::bind_static_method("AnimationTextureBaker", D_METHOD("create_vertex_playback_shader"), &AnimationTextureBaker::create_vertex_playback_shader);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fps", PROPERTY_HINT_RANGE, "1,120,0.1,or_greater,suffix:FPS"), "set_fps", "get_fps");
+
+	BIND_ENUM_CONSTANT(VERTEX_DATA_POSITION);
+	BIND_ENUM_CONSTANT(VERTEX_DATA_NORMAL);
+	BIND_ENUM_CONSTANT(VERTEX_DATA_TANGENT);
+	BIND_ENUM_CONSTANT(VERTEX_DATA_MAX);
+}
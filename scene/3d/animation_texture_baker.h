@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  animation_texture_baker.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/image.h"
+#include "scene/resources/3d/skin.h"
+#include "scene/resources/animation.h"
+#include "scene/resources/mesh.h"
+#include "scene/resources/shader.h"
+
+class Node;
+class Skeleton3D;
+
+class AnimationTextureBaker : public RefCounted {
+	GDCLASS(AnimationTextureBaker, RefCounted);
+
+public:
+	enum {
+		// Size limit of baked textures. Most desktop GPUs support it, but drivers only guarantee 4096 pixels (2048 with OpenGL ES).
+		MAX_TEXTURE_SIZE = 16384,
+		BONE_TEXELS = 3, // One RGBA texel per row of the 3x4 skinning matrix.
+	};
+
+	enum VertexData {
+		VERTEX_DATA_POSITION,
+		VERTEX_DATA_NORMAL,
+		VERTEX_DATA_TANGENT,
+		VERTEX_DATA_MAX,
+	};
+
+private:
+	double fps = 30.0;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_fps(double p_fps);
+	double get_fps() const;
+
+	int get_frame_count(const Ref<Animation> &p_animation) const;
+
+	Ref<Image> bake_bone_texture(Skeleton3D *p_skeleton, const Ref<Skin> &p_skin, const Ref<Animation> &p_animation, Node *p_root_node = nullptr) const;
+	Ref<Image> bake_vertex_texture(const Ref<Mesh> &p_mesh, int p_surface, const Ref<Image> &p_bone_texture, VertexData p_data = VERTEX_DATA_POSITION) const;
+
+	static Transform3D get_bone_texture_transform(const Ref<Image> &p_bone_texture, int p_frame, int p_bind);
+	static Ref<Shader> create_vertex_playback_shader();
+};
+
+VARIANT_ENUM_CAST(AnimationTextureBaker::VertexData);
@@ -396,11 +396,31 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
-				for (uint32_t i = 0; i < bind_count; i++) {
+				// Upload all bones in a single call.
+				E->bone_buffer.resize(bind_count * 12);
+				float *dataptr = E->bone_buffer.ptrw();
+				for (uint32_t i = 0; i < bind_count; i++, dataptr += 12) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					Transform3D xform;
+					if (likely(bone_index < (uint32_t)len)) {
+						xform = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+					} else {
+						ERR_PRINT("Skin bind #" + itos(i) + " refers to bone " + itos(bone_index) + ", which is greater than the skeleton bone count: " + itos(len) + ".");
+					}
+					dataptr[0] = xform.basis.rows[0][0];
+					dataptr[1] = xform.basis.rows[0][1];
+					dataptr[2] = xform.basis.rows[0][2];
+					dataptr[3] = xform.origin.x;
+					dataptr[4] = xform.basis.rows[1][0];
+					dataptr[5] = xform.basis.rows[1][1];
+					dataptr[6] = xform.basis.rows[1][2];
+					dataptr[7] = xform.origin.y;
+					dataptr[8] = xform.basis.rows[2][0];
+					dataptr[9] = xform.basis.rows[2][1];
+					dataptr[10] = xform.basis.rows[2][2];
+					dataptr[11] = xform.origin.z;
 				}
+				rs->skeleton_set_buffer(skeleton, E->bone_buffer);
 			}
 
 			if (!modifiers.is_empty()) {
@@ -1061,8 +1081,9 @@ void Skeleton3D::force_update_all_bone_transforms() {
 
 void Skeleton3D::_force_update_all_bone_transforms() const {
 	_update_process_order();
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		_force_update_bone_children_transforms(parentless_bones[i]);
+	if (!parentless_bones.is_empty()) {
+		// A single pass over the nested set updates every dirty bone, whichever root it starts from.
+		_force_update_bone_children_transforms(parentless_bones[0]);
 	}
 	if (rest_dirty) {
 		rest_dirty = false;
@@ -33,19 +33,24 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
+#include "scene/2d/visible_on_screen_notifier_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/audio/audio_stream_player.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/animation.h"
 #include "servers/audio/audio_stream.h"
 #include "servers/audio_server.h"
 
 #ifndef _3D_DISABLED
 #include "scene/3d/audio_stream_player_3d.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
@@ -132,6 +137,7 @@ void AnimationMixer::_validate_property(PropertyInfo &p_property) const {
 void AnimationMixer::_animation_set_cache_update() {
 	// Relatively fast function to update all animations.
 	animation_set_update_pass++;
+	lod_max_skipped_delta_dirty = true;
 	bool clear_cache_needed = false;
 
 	// Update changed and add otherwise.
@@ -215,6 +221,7 @@ void AnimationMixer::_animation_renamed(const StringName &p_name, const StringNa
 }
 
 void AnimationMixer::_animation_changed(const StringName &p_name) {
+	lod_max_skipped_delta_dirty = true;
 	_clear_caches();
 }
 
@@ -562,6 +569,11 @@ bool AnimationMixer::is_dummy() const {
 /* -------------------------------------------- */
 
 void AnimationMixer::_clear_caches() {
+	if (pending_blend != PENDING_BLEND_NONE) {
+		// The pending blend refers to the caches being cleared, drop it.
+		pending_blend = PENDING_BLEND_NONE;
+		clear_animation_instances();
+	}
 	_init_root_motion_cache();
 	_clear_audio_streams();
 	_clear_playing_caches();
@@ -970,6 +982,14 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	blend_thread_safe = true;
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->root_motion = K.value->path == root_motion_track;
+		if (K.value->type != Animation::TYPE_POSITION_3D && K.value->type != Animation::TYPE_BLEND_SHAPE) {
+			blend_thread_safe = false; // Value, method, audio and animation tracks may call into other objects.
+		}
+	}
+
 	cache_valid = true;
 
 	return true;
@@ -979,11 +999,22 @@ bool AnimationMixer::_update_caches() {
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
 
-void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+void AnimationMixer::_process_animation(double p_delta, bool p_update_only, bool p_allow_parallel) {
+	_finish_pending_blend();
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
 		_blend_calc_total_weight();
+		if (p_allow_parallel && !p_update_only && _can_blend_in_parallel()) {
+			// Playback already advanced here, only sampling and applying are deferred.
+			pending_blend = PENDING_BLEND_PROCESS;
+			pending_blend_delta = p_delta;
+			if (pending_blend_mixers.is_empty()) {
+				callable_mp_static(&AnimationMixer::_flush_pending_blends).call_deferred();
+			}
+			pending_blend_mixers.push_back(get_instance_id());
+			return;
+		}
 		_blend_process(p_delta, p_update_only);
 		_blend_apply();
 		_blend_post_process();
@@ -992,6 +1023,63 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+LocalVector<ObjectID> AnimationMixer::pending_blend_mixers;
+LocalVector<AnimationMixer *> AnimationMixer::pending_blend_process;
+
+bool AnimationMixer::_can_blend_in_parallel() const {
+	if (!blend_thread_safe || !Thread::is_main_thread()) {
+		return false; // Mixers processed in thread groups are already off the main thread.
+	}
+	if (GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+	return GLOBAL_GET_CACHED(bool, "animation/mixer/parallel_blending");
+}
+
+void AnimationMixer::_finish_pending_blend() {
+	if (pending_blend == PENDING_BLEND_NONE) {
+		return;
+	}
+	if (pending_blend == PENDING_BLEND_PROCESS) {
+		_blend_process(pending_blend_delta);
+	}
+	pending_blend = PENDING_BLEND_NONE;
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	clear_animation_instances();
+}
+
+void AnimationMixer::_blend_process_pending(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = pending_blend_process[p_index];
+	mixer->_blend_process(mixer->pending_blend_delta);
+	mixer->pending_blend = PENDING_BLEND_APPLY;
+}
+
+void AnimationMixer::_flush_pending_blends() {
+	for (const ObjectID &id : pending_blend_mixers) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->pending_blend == PENDING_BLEND_PROCESS) {
+			pending_blend_process.push_back(mixer);
+		}
+	}
+
+	if (pending_blend_process.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_process_pending, nullptr, pending_blend_process.size(), -1, true, SNAME("AnimationMixer"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+	pending_blend_process.clear();
+
+	// Applying may trigger signals and method calls that process other mixers, which finish their own blend first.
+	for (uint32_t i = 0; i < pending_blend_mixers.size(); i++) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(pending_blend_mixers[i]);
+		if (mixer) {
+			mixer->_finish_pending_blend();
+		}
+	}
+	pending_blend_mixers.clear();
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1210,7 +1298,6 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
-			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1439,7 +1526,13 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							continue;
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
-						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+						if (Math::is_equal_approx(blend, (real_t)1.0)) {
+							// Full weight is by far the most common case, skip the slerp from identity but keep its shortest path.
+							Quaternion diff = t->init_rot.inverse() * rot;
+							t->rot = (t->rot * (diff.w < 0 ? -diff : diff)).normalized();
+						} else {
+							t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+						}
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1847,9 +1940,20 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 }
 
 void AnimationMixer::_blend_apply() {
+#ifndef _3D_DISABLED
+	// Bone tracks of the same skeleton are usually next to each other, so remember the last one looked up.
+	ObjectID last_skeleton_id;
+	Skeleton3D *last_skeleton = nullptr;
+#endif // _3D_DISABLED
+
 	// Finally, set the tracks.
 	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
+#ifndef _3D_DISABLED
+		if (track->type != Animation::TYPE_POSITION_3D) {
+			last_skeleton_id = ObjectID(); // Other tracks may run arbitrary code.
+		}
+#endif // _3D_DISABLED
 		bool is_zero_amount = Math::is_zero_approx(track->total_weight);
 		if (!deterministic && is_zero_amount) {
 			continue;
@@ -1867,7 +1971,11 @@ void AnimationMixer::_blend_apply() {
 					root_motion_rotation_accumulator = t->rot;
 					root_motion_scale_accumulator = t->scale;
 				} else if (t->skeleton_id.is_valid() && t->bone_idx >= 0) {
-					Skeleton3D *t_skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
+					if (t->skeleton_id != last_skeleton_id) {
+						last_skeleton_id = t->skeleton_id;
+						last_skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
+					}
+					Skeleton3D *t_skeleton = last_skeleton;
 					if (!t_skeleton) {
 						return;
 					}
@@ -1882,6 +1990,7 @@ void AnimationMixer::_blend_apply() {
 					}
 
 				} else if (!t->skeleton_id.is_valid()) {
+					last_skeleton_id = ObjectID(); // Transform notifications may run arbitrary code.
 					Node3D *t_node_3d = ObjectDB::get_instance<Node3D>(t->object_id);
 					if (!t_node_3d) {
 						return;
@@ -2059,12 +2168,128 @@ void AnimationMixer::clear_caches() {
 	_clear_caches();
 }
 
+/* -------------------------------------------- */
+/* -- Level of detail ------------------------- */
+/* -------------------------------------------- */
+
+SafeNumeric<uint64_t> AnimationMixer::lod_skipped_update_count;
+
+void AnimationMixer::set_lod_distance(real_t p_distance) {
+	lod_distance = MAX(p_distance, 0);
+}
+
+real_t AnimationMixer::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationMixer::set_lod_max_skipped_frames(int p_frames) {
+	lod_max_skipped_frames = MAX(p_frames, 0);
+}
+
+int AnimationMixer::get_lod_max_skipped_frames() const {
+	return lod_max_skipped_frames;
+}
+
+void AnimationMixer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+	lod_visibility_notifier_id = ObjectID();
+}
+
+NodePath AnimationMixer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+uint64_t AnimationMixer::get_lod_skipped_update_count() {
+	return lod_skipped_update_count.get();
+}
+
+int AnimationMixer::_get_lod_frames_to_skip() {
+	if (!lod_visibility_notifier.is_empty()) {
+		Node *notifier = ObjectDB::get_instance<Node>(lod_visibility_notifier_id);
+		if (!notifier) {
+			notifier = get_node_or_null(lod_visibility_notifier);
+			lod_visibility_notifier_id = notifier ? notifier->get_instance_id() : ObjectID();
+		}
+		VisibleOnScreenNotifier2D *notifier_2d = Object::cast_to<VisibleOnScreenNotifier2D>(notifier);
+		if (notifier_2d && !notifier_2d->is_on_screen()) {
+			return -1;
+		}
+#ifndef _3D_DISABLED
+		VisibleOnScreenNotifier3D *notifier_3d = Object::cast_to<VisibleOnScreenNotifier3D>(notifier);
+		if (notifier_3d && !notifier_3d->is_on_screen()) {
+			return -1;
+		}
+#endif // _3D_DISABLED
+	}
+
+#ifndef _3D_DISABLED
+	real_t distance_step = lod_distance * GLOBAL_GET_CACHED(real_t, "animation/mixer/lod_distance_scale");
+	if (distance_step <= 0 || lod_max_skipped_frames == 0) {
+		return 0;
+	}
+	Node3D *root = Object::cast_to<Node3D>(get_node_or_null(root_node));
+	Camera3D *camera = get_viewport() ? get_viewport()->get_camera_3d() : nullptr;
+	if (!root || !camera) {
+		return 0;
+	}
+	// One more frame is skipped for every LOD distance step away from the camera.
+	real_t distance = root->get_global_position().distance_to(camera->get_global_position());
+	return MIN((int)(distance / distance_step), lod_max_skipped_frames);
+#else
+	return 0;
+#endif // _3D_DISABLED
+}
+
+double AnimationMixer::_get_lod_max_skipped_delta() {
+	if (lod_max_skipped_delta_dirty) {
+		lod_max_skipped_delta = 0.0;
+		for (const KeyValue<StringName, AnimationData> &E : animation_set) {
+			if (E.value.animation.is_valid()) {
+				lod_max_skipped_delta = MAX(lod_max_skipped_delta, E.value.animation->get_length());
+			}
+		}
+		lod_max_skipped_delta_dirty = false;
+	}
+	return lod_max_skipped_delta;
+}
+
+bool AnimationMixer::_lod_skip_update(double &r_delta) {
+	if (lod_distance <= 0 && lod_visibility_notifier.is_empty() && lod_skipped_frames == 0) {
+		return false;
+	}
+	int frames_to_skip = _get_lod_frames_to_skip();
+	lod_skipped_delta += r_delta;
+	if (frames_to_skip < 0) {
+		// Off-screen mixers can skip for a long time. Once the longest animation has been skipped,
+		// non-looping animations have ended anyway, so the caught up time is capped there.
+		lod_skipped_delta = MIN(lod_skipped_delta, _get_lod_max_skipped_delta());
+	}
+	if (frames_to_skip < 0 || lod_skipped_frames < frames_to_skip) {
+		// Skipped time is accumulated so playback stays in sync once the mixer updates again.
+		lod_skipped_frames++;
+		// Root motion is meant to be applied once per update, so skipped frames have none.
+		// The motion of the skipped time is part of the next update instead.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		lod_skipped_update_count.increment();
+		return true;
+	}
+	r_delta = lod_skipped_delta;
+	lod_skipped_delta = 0.0;
+	lod_skipped_frames = 0;
+	return false;
+}
+
 /* -------------------------------------------- */
 /* -- Root motion ----------------------------- */
 /* -------------------------------------------- */
 
 void AnimationMixer::set_root_motion_track(const NodePath &p_track) {
 	root_motion_track = p_track;
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->root_motion = K.value->path == root_motion_track;
+	}
 	notify_property_list_changed();
 }
 
@@ -2343,18 +2568,25 @@ void AnimationMixer::_notification(int p_what) {
 				set_physics_process_internal(false);
 				set_process_internal(false);
 			}
+			lod_visibility_notifier_id = ObjectID();
 			_clear_caches();
 		} break;
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				double delta = get_process_delta_time();
+				if (!_lod_skip_update(delta)) {
+					_process_animation(delta, false, true);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				double delta = get_physics_process_delta_time();
+				if (!_lod_skip_update(delta)) {
+					_process_animation(delta, false, true);
+				}
 			}
 		} break;
 
@@ -2422,6 +2654,14 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_audio_max_polyphony", "max_polyphony"), &AnimationMixer::set_audio_max_polyphony);
 	ClassDB::bind_method(D_METHOD("get_audio_max_polyphony"), &AnimationMixer::get_audio_max_polyphony);
 
+	/* ---- Level of detail ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_max_skipped_frames", "frames"), &AnimationMixer::set_lod_max_skipped_frames);
+	ClassDB::bind_method(D_METHOD("get_lod_max_skipped_frames"), &AnimationMixer::get_lod_max_skipped_frames);
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationMixer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationMixer::get_lod_visibility_notifier);
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	ClassDB::bind_method(D_METHOD("set_root_motion_track", "path"), &AnimationMixer::set_root_motion_track);
 	ClassDB::bind_method(D_METHOD("get_root_motion_track"), &AnimationMixer::get_root_motion_track);
@@ -2459,6 +2699,11 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_max_skipped_frames", PROPERTY_HINT_RANGE, "0,60,1,or_greater"), "set_lod_max_skipped_frames", "get_lod_max_skipped_frames");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier2D,VisibleOnScreenNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+
 	ADD_GROUP("Callback Mode", "callback_mode_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_process", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_callback_mode_process", "get_callback_mode_process");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_method", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_callback_mode_method", "get_callback_mode_method");
@@ -163,6 +163,8 @@ protected:
 		virtual ~TrackCache() {}
 	};
 
+	// Blended values stay in each cache instead of pose arrays owned by the mixer,
+	// as AnimatedValuesBackup restores them by applying copies of the caches.
 	struct TrackCacheTransform : public TrackCache {
 #ifndef _3D_DISABLED
 		ObjectID skeleton_id;
@@ -356,7 +358,7 @@ protected:
 	virtual void _rename_animation(const StringName &p_from_name, const StringName &p_to_name);
 
 	/* ---- Blending processor ---- */
-	virtual void _process_animation(double p_delta, bool p_update_only = false);
+	virtual void _process_animation(double p_delta, bool p_update_only = false, bool p_allow_parallel = false);
 
 	// For post process with retrieved key value during blending.
 	virtual Variant _post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
@@ -372,6 +374,40 @@ protected:
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
+	/* ---- Level of detail ---- */
+	real_t lod_distance = 0.0;
+	int lod_max_skipped_frames = 3;
+	NodePath lod_visibility_notifier;
+	ObjectID lod_visibility_notifier_id;
+	int lod_skipped_frames = 0;
+	double lod_skipped_delta = 0.0;
+	double lod_max_skipped_delta = 0.0; // Length of the longest animation, updated when the animations change.
+	bool lod_max_skipped_delta_dirty = true;
+
+	static SafeNumeric<uint64_t> lod_skipped_update_count;
+	int _get_lod_frames_to_skip();
+	double _get_lod_max_skipped_delta();
+	bool _lod_skip_update(double &r_delta);
+
+	/* ---- Parallel blending ---- */
+	// Mixers whose caches only hold transform and blend shape tracks don't touch other objects while sampling,
+	// so their sampling is batched and run on the WorkerThreadPool, then applied on the main thread.
+	enum PendingBlend {
+		PENDING_BLEND_NONE,
+		PENDING_BLEND_PROCESS, // Waiting for sampling.
+		PENDING_BLEND_APPLY, // Sampled, waiting to be applied.
+	};
+	PendingBlend pending_blend = PENDING_BLEND_NONE;
+	double pending_blend_delta = 0.0;
+	bool blend_thread_safe = false;
+
+	static LocalVector<ObjectID> pending_blend_mixers;
+	static LocalVector<AnimationMixer *> pending_blend_process;
+	static void _blend_process_pending(void *p_userdata, uint32_t p_index);
+	static void _flush_pending_blends();
+	bool _can_blend_in_parallel() const;
+	void _finish_pending_blend();
+
 	/* ---- Capture feature ---- */
 	struct CaptureCache {
 		Ref<Animation> animation;
@@ -438,6 +474,18 @@ public:
 	void set_audio_max_polyphony(int p_audio_max_polyphony);
 	int get_audio_max_polyphony() const;
 
+	/* ---- Level of detail ---- */
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_max_skipped_frames(int p_frames);
+	int get_lod_max_skipped_frames() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+
+	static uint64_t get_lod_skipped_update_count();
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	void set_root_motion_track(const NodePath &p_track);
 	NodePath get_root_motion_track() const;
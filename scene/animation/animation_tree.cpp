@@ -88,9 +88,11 @@ void AnimationNode::set_parameter(const StringName &p_name, const Variant &p_val
 		return;
 	}
 
-	ERR_FAIL_COND(!process_state->tree->property_parent_map.has(node_state.base_path));
-	ERR_FAIL_COND(!process_state->tree->property_parent_map[node_state.base_path].has(p_name));
-	StringName path = process_state->tree->property_parent_map[node_state.base_path][p_name];
+	const AnimationRootNode::ParameterLayout *layout = process_state->tree->_get_parameter_layout();
+	ERR_FAIL_NULL(layout);
+	ERR_FAIL_COND(!layout->property_parent_map.has(node_state.base_path));
+	ERR_FAIL_COND(!layout->property_parent_map[node_state.base_path].has(p_name));
+	StringName path = layout->property_parent_map[node_state.base_path][p_name];
 	int idx = process_state->tree->property_map.get_index(path);
 	property_cache.insert_new(p_name, idx);
 	process_state->tree->property_map.get_by_index(idx).value.first = p_value;
@@ -102,10 +104,12 @@ Variant AnimationNode::get_parameter(const StringName &p_name) const {
 	if (it) {
 		return process_state->tree->property_map.get_by_index(it->value).value.first;
 	}
-	ERR_FAIL_COND_V(!process_state->tree->property_parent_map.has(node_state.base_path), Variant());
-	ERR_FAIL_COND_V(!process_state->tree->property_parent_map[node_state.base_path].has(p_name), Variant());
+	const AnimationRootNode::ParameterLayout *layout = process_state->tree->_get_parameter_layout();
+	ERR_FAIL_NULL_V(layout, Variant());
+	ERR_FAIL_COND_V(!layout->property_parent_map.has(node_state.base_path), Variant());
+	ERR_FAIL_COND_V(!layout->property_parent_map[node_state.base_path].has(p_name), Variant());
 
-	StringName path = process_state->tree->property_parent_map[node_state.base_path][p_name];
+	StringName path = layout->property_parent_map[node_state.base_path][p_name];
 	int idx = process_state->tree->property_map.get_index(path);
 	property_cache.insert_new(p_name, idx);
 	return process_state->tree->property_map.get_by_index(idx).value.first;
@@ -295,19 +299,20 @@ AnimationNode::NodeTimeInfo AnimationNode::_blend_node(Ref<AnimationNode> p_node
 		}
 	}
 
-	String new_path;
 	AnimationNode *new_parent;
+	StringName parent_path;
 
-	// This is the slowest part of processing, but as strings process in powers of 2, and the paths always exist, it will not result in that many allocations.
 	if (p_new_parent) {
 		new_parent = p_new_parent;
-		new_path = String(node_state.base_path) + String(p_subpath) + "/";
+		parent_path = node_state.base_path;
 	} else {
 		ERR_FAIL_NULL_V(node_state.parent, NodeTimeInfo());
 		new_parent = node_state.parent;
-		new_path = String(new_parent->node_state.base_path) + String(p_subpath) + "/";
+		parent_path = new_parent->node_state.base_path;
 	}
 
+	StringName new_path = process_state->tree->_get_child_path(parent_path, p_subpath);
+
 	// This process, which depends on p_sync is needed to process sync correctly in the case of
 	// that a synced AnimationNodeSync exists under the un-synced AnimationNodeSync.
 	p_node->set_node_state_base_path(new_path);
@@ -611,6 +616,16 @@ void AnimationRootNode::_animation_node_removed(const ObjectID &p_oid, const Str
 	emit_signal(SNAME("animation_node_removed"), p_oid, p_node);
 }
 
+void AnimationRootNode::_invalidate_parameter_layout() {
+	MutexLock lock(parameter_layout_mutex);
+	parameter_layout.valid = false;
+}
+
+AnimationRootNode::AnimationRootNode() {
+	// The graph can be edited while no AnimationTree uses it, so the layout can't rely on them to be invalidated.
+	connect(SNAME("tree_changed"), callable_mp(this, &AnimationRootNode::_invalidate_parameter_layout));
+}
+
 ////////////////////
 
 void AnimationTree::set_root_animation_node(const Ref<AnimationRootNode> &p_animation_node) {
@@ -723,6 +738,10 @@ PackedStringArray AnimationTree::get_configuration_warnings() const {
 }
 
 void AnimationTree::_tree_changed() {
+	if (root_animation_node.is_valid()) {
+		root_animation_node->_invalidate_parameter_layout();
+	}
+
 	if (properties_dirty) {
 		return;
 	}
@@ -732,82 +751,136 @@ void AnimationTree::_tree_changed() {
 }
 
 void AnimationTree::_animation_node_renamed(const ObjectID &p_oid, const String &p_old_name, const String &p_new_name) {
-	ERR_FAIL_COND(!property_reference_map.has(p_oid));
-	String base_path = property_reference_map[p_oid];
+	ERR_FAIL_COND(root_animation_node.is_null());
+	// The layout may have been invalidated by the change already, but base paths of the nodes are still usable.
+	const AnimationRootNode::ParameterLayout *layout = &root_animation_node->parameter_layout;
+	ERR_FAIL_COND(!layout->property_reference_map.has(p_oid));
+	String base_path = layout->property_reference_map[p_oid];
 	String old_base = base_path + p_old_name;
 	String new_base = base_path + p_new_name;
-	for (const PropertyInfo &E : properties) {
-		if (E.name.begins_with(old_base)) {
-			String new_name = E.name.replace_first(old_base, new_base);
-			property_map[new_name] = property_map[E.name];
-			property_map.erase(E.name);
+	// The layout may already have been updated by another AnimationTree sharing the root node, so look up the values instead.
+	LocalVector<StringName> renamed;
+	for (const KeyValue<StringName, Pair<Variant, bool>> &E : property_map) {
+		if (String(E.key).begins_with(old_base)) {
+			renamed.push_back(E.key);
 		}
 	}
+	for (const StringName &name : renamed) {
+		String new_name = String(name).replace_first(old_base, new_base);
+		property_map[new_name] = property_map[name];
+		property_map.erase(name);
+	}
 
 	// Update tree second.
+	root_animation_node->_invalidate_parameter_layout();
 	properties_dirty = true;
 	_update_properties();
 }
 
 void AnimationTree::_animation_node_removed(const ObjectID &p_oid, const StringName &p_node) {
-	ERR_FAIL_COND(!property_reference_map.has(p_oid));
-	String base_path = String(property_reference_map[p_oid]) + String(p_node);
-	for (const PropertyInfo &E : properties) {
-		if (E.name.begins_with(base_path)) {
-			property_map.erase(E.name);
+	ERR_FAIL_COND(root_animation_node.is_null());
+	// The layout may have been invalidated by the change already, but base paths of the nodes are still usable.
+	const AnimationRootNode::ParameterLayout *layout = &root_animation_node->parameter_layout;
+	ERR_FAIL_COND(!layout->property_reference_map.has(p_oid));
+	String base_path = String(layout->property_reference_map[p_oid]) + String(p_node);
+	LocalVector<StringName> removed;
+	for (const KeyValue<StringName, Pair<Variant, bool>> &E : property_map) {
+		if (String(E.key).begins_with(base_path)) {
+			removed.push_back(E.key);
 		}
 	}
+	for (const StringName &name : removed) {
+		property_map.erase(name);
+	}
 
 	// Update tree second.
+	root_animation_node->_invalidate_parameter_layout();
 	properties_dirty = true;
 	_update_properties();
 }
 
-void AnimationTree::_update_properties_for_node(const String &p_base_path, Ref<AnimationNode> p_node) const {
+void AnimationTree::_update_properties_for_node(AnimationRootNode::ParameterLayout &r_layout, const String &p_base_path, Ref<AnimationNode> p_node) {
 	ERR_FAIL_COND(p_node.is_null());
-	if (!property_parent_map.has(p_base_path)) {
-		property_parent_map[p_base_path] = AHashMap<StringName, StringName>();
+	if (!r_layout.property_parent_map.has(p_base_path)) {
+		r_layout.property_parent_map[p_base_path] = AHashMap<StringName, StringName>();
 	}
-	if (!property_reference_map.has(p_node->get_instance_id())) {
-		property_reference_map[p_node->get_instance_id()] = p_base_path;
+	if (!r_layout.property_reference_map.has(p_node->get_instance_id())) {
+		r_layout.property_reference_map[p_node->get_instance_id()] = p_base_path;
 	}
 
-	if (p_node->get_input_count() && !input_activity_map.has(p_base_path)) {
-		LocalVector<Activity> activity;
-		for (int i = 0; i < p_node->get_input_count(); i++) {
-			Activity a;
-			a.activity = 0;
-			a.last_pass = 0;
-			activity.push_back(a);
-		}
-		input_activity_map[p_base_path] = activity;
-		input_activity_map_get[String(p_base_path).substr(0, String(p_base_path).length() - 1)] = input_activity_map.get_index(p_base_path);
+	if (p_node->get_input_count() && !r_layout.input_activity_map_get.has(String(p_base_path).substr(0, String(p_base_path).length() - 1))) {
+		r_layout.input_activity_map_get[String(p_base_path).substr(0, String(p_base_path).length() - 1)] = r_layout.inputs.size();
+		r_layout.inputs.push_back(Pair<StringName, int>(p_base_path, p_node->get_input_count()));
 	}
 
 	List<PropertyInfo> plist;
 	p_node->get_parameter_list(&plist);
 	for (PropertyInfo &pinfo : plist) {
 		StringName key = pinfo.name;
-
-		if (!property_map.has(p_base_path + key)) {
-			Pair<Variant, bool> param;
-			param.first = p_node->get_parameter_default_value(key);
-			param.second = p_node->is_parameter_read_only(key);
-			property_map[p_base_path + key] = param;
+		StringName name = p_base_path + key;
+
+		if (!r_layout.parameter_indices.has(name)) {
+			AnimationRootNode::ParameterLayout::Parameter param;
+			param.name = name;
+			param.node = p_node->get_instance_id();
+			param.key = key;
+			param.default_value = p_node->get_parameter_default_value(key);
+			param.unique_default = param.default_value.get_type() == Variant::OBJECT || param.default_value.get_type() == Variant::ARRAY || param.default_value.get_type() == Variant::DICTIONARY;
+			if (param.unique_default) {
+				param.default_value = Variant();
+			}
+			param.read_only = p_node->is_parameter_read_only(key);
+			r_layout.parameter_indices[name] = r_layout.parameters.size();
+			r_layout.parameters.push_back(param);
 		}
 
-		property_parent_map[p_base_path][key] = p_base_path + key;
+		r_layout.property_parent_map[p_base_path][key] = name;
 
-		pinfo.name = p_base_path + key;
-		properties.push_back(pinfo);
+		pinfo.name = name;
+		r_layout.properties.push_back(pinfo);
 	}
 	p_node->make_cache_dirty();
 	List<AnimationNode::ChildNode> children;
 	p_node->get_child_nodes(&children);
 
 	for (const AnimationNode::ChildNode &E : children) {
-		_update_properties_for_node(p_base_path + E.name + "/", E.node);
+		_update_properties_for_node(r_layout, p_base_path + E.name + "/", E.node);
+	}
+}
+
+const AnimationRootNode::ParameterLayout *AnimationTree::_get_parameter_layout() const {
+	if (root_animation_node.is_null() || !root_animation_node->parameter_layout.valid) {
+		return nullptr;
+	}
+	return &root_animation_node->parameter_layout;
+}
+
+StringName AnimationTree::_get_child_path(const StringName &p_parent_path, const StringName &p_subpath) const {
+	// Building the path is the slowest part of processing, so it is only done once for each parent path and subpath.
+	int slot = -1;
+	if (root_animation_node.is_valid() && root_animation_node->parameter_layout.valid) {
+		slot = root_animation_node->parameter_layout.property_parent_map.get_index(p_parent_path);
+	}
+	if (slot < 0) {
+		return String(p_parent_path) + String(p_subpath) + "/";
 	}
+	if (slot >= (int)child_path_cache.size()) {
+		child_path_cache.resize(slot + 1);
+	}
+
+	ChildPathCache &cache = child_path_cache[slot];
+	if (cache.base_path != p_parent_path) {
+		// Another AnimationTree rebuilt the shared layout since this slot was filled.
+		cache.base_path = p_parent_path;
+		cache.child_paths.clear();
+	}
+	const StringName *cached_path = cache.child_paths.getptr(p_subpath);
+	if (cached_path) {
+		return *cached_path;
+	}
+	StringName new_path = String(p_parent_path) + String(p_subpath) + "/";
+	cache.child_paths.insert(p_subpath, new_path);
+	return new_path;
 }
 
 void AnimationTree::_update_properties() const {
@@ -815,14 +888,47 @@ void AnimationTree::_update_properties() const {
 		return;
 	}
 
-	properties.clear();
-	property_reference_map.clear();
-	property_parent_map.clear();
+	// Values already set on this AnimationTree are kept, even if the layout changed.
+	const AHashMap<StringName, Pair<Variant, bool>> previous_property_map = property_map;
+	property_map.clear();
 	input_activity_map.clear();
-	input_activity_map_get.clear();
+	child_path_cache.clear();
 
 	if (root_animation_node.is_valid()) {
-		_update_properties_for_node(Animation::PARAMETERS_BASE_PATH, root_animation_node);
+		MutexLock lock(root_animation_node->parameter_layout_mutex);
+		AnimationRootNode::ParameterLayout &layout = root_animation_node->parameter_layout;
+		if (!layout.valid) {
+			layout = AnimationRootNode::ParameterLayout();
+			_update_properties_for_node(layout, Animation::PARAMETERS_BASE_PATH, root_animation_node);
+			layout.valid = true;
+		}
+
+		property_map.reserve(layout.parameters.size());
+		for (const AnimationRootNode::ParameterLayout::Parameter &param : layout.parameters) {
+			Pair<Variant, bool> value;
+			const Pair<Variant, bool> *previous = previous_property_map.getptr(param.name);
+			if (previous) {
+				value.first = previous->first;
+			} else if (param.unique_default) {
+				AnimationNode *node = ObjectDB::get_instance<AnimationNode>(param.node);
+				if (node) {
+					value.first = node->get_parameter_default_value(param.key);
+				}
+			} else {
+				value.first = param.default_value;
+			}
+			value.second = param.read_only;
+			property_map.insert(param.name, value);
+		}
+
+		input_activity_map.reserve(layout.inputs.size());
+		for (const Pair<StringName, int> &input : layout.inputs) {
+			LocalVector<Activity> activity;
+			activity.resize(input.second);
+			input_activity_map.insert(input.first, activity);
+		}
+
+		child_path_cache.resize(layout.property_parent_map.size());
 	}
 
 	properties_dirty = false;
@@ -970,17 +1076,23 @@ void AnimationTree::_get_property_list(List<PropertyInfo> *p_list) const {
 		_update_properties();
 	}
 
-	for (const PropertyInfo &E : properties) {
+	const AnimationRootNode::ParameterLayout *layout = _get_parameter_layout();
+	if (!layout) {
+		return;
+	}
+	for (const PropertyInfo &E : layout->properties) {
 		p_list->push_back(E);
 	}
 }
 
 real_t AnimationTree::get_connection_activity(const StringName &p_path, int p_connection) const {
-	if (!input_activity_map_get.has(p_path)) {
+	const AnimationRootNode::ParameterLayout *layout = _get_parameter_layout();
+	if (!layout || !layout->input_activity_map_get.has(p_path)) {
 		return 0;
 	}
 
-	int index = input_activity_map_get[p_path];
+	int index = layout->input_activity_map_get[p_path];
+	ERR_FAIL_INDEX_V(index, (int)input_activity_map.size(), 0);
 	const LocalVector<Activity> &activity = input_activity_map.get_by_index(index).value;
 
 	if (p_connection < 0 || p_connection >= (int64_t)activity.size() || activity[p_connection].last_pass != process_pass) {
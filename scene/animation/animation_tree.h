@@ -247,10 +247,42 @@ VARIANT_ENUM_CAST(AnimationNode::FilterAction)
 class AnimationRootNode : public AnimationNode {
 	GDCLASS(AnimationRootNode, AnimationNode);
 
+	friend class AnimationNode;
+	friend class AnimationTree;
+
+	// The parameters below a root node only depend on the graph, so they are laid out once by the first AnimationTree
+	// using the root node and shared by all the others. Each AnimationTree only keeps the values, in the same order.
+	struct ParameterLayout {
+		struct Parameter {
+			StringName name;
+			ObjectID node;
+			StringName key;
+			Variant default_value;
+			bool unique_default = false; // Objects and containers must not be shared, so the default is created by each AnimationTree.
+			bool read_only = false;
+		};
+
+		bool valid = false;
+		LocalVector<Parameter> parameters;
+		AHashMap<StringName, uint32_t> parameter_indices;
+		LocalVector<Pair<StringName, int>> inputs; // Base path and input count of the nodes with inputs.
+		List<PropertyInfo> properties;
+		AHashMap<StringName, AHashMap<StringName, StringName>> property_parent_map;
+		AHashMap<ObjectID, StringName> property_reference_map;
+		AHashMap<StringName, int> input_activity_map_get;
+	};
+	mutable ParameterLayout parameter_layout;
+	mutable Mutex parameter_layout_mutex; // AnimationTrees sharing the root node may update their properties from different threads.
+
+	void _invalidate_parameter_layout();
+
 protected:
 	virtual void _tree_changed();
 	virtual void _animation_node_renamed(const ObjectID &p_oid, const String &p_old_name, const String &p_new_name);
 	virtual void _animation_node_removed(const ObjectID &p_oid, const StringName &p_node);
+
+public:
+	AnimationRootNode();
 };
 
 class AnimationNodeStartState : public AnimationRootNode {
@@ -284,15 +316,22 @@ private:
 
 	friend class AnimationNode;
 
-	mutable List<PropertyInfo> properties;
-	mutable AHashMap<StringName, AHashMap<StringName, StringName>> property_parent_map;
-	mutable AHashMap<ObjectID, StringName> property_reference_map;
-	mutable AHashMap<StringName, Pair<Variant, bool>> property_map; // Property value and read-only flag.
+	mutable AHashMap<StringName, Pair<Variant, bool>> property_map; // Property value and read-only flag, in the order of the parameter layout.
+
+	// Base paths of the children blended below each base path of the parameter layout, in the same order.
+	// The AnimationNodes are shared between AnimationTrees, so the paths are cached here rather than in the nodes.
+	struct ChildPathCache {
+		StringName base_path;
+		AHashMap<StringName, StringName> child_paths;
+	};
+	mutable LocalVector<ChildPathCache> child_path_cache;
+	StringName _get_child_path(const StringName &p_parent_path, const StringName &p_subpath) const;
 
 	mutable bool properties_dirty = true;
 
 	void _update_properties() const;
-	void _update_properties_for_node(const String &p_base_path, Ref<AnimationNode> p_node) const;
+	static void _update_properties_for_node(AnimationRootNode::ParameterLayout &r_layout, const String &p_base_path, Ref<AnimationNode> p_node);
+	const AnimationRootNode::ParameterLayout *_get_parameter_layout() const;
 
 	void _tree_changed();
 	void _animation_node_renamed(const ObjectID &p_oid, const String &p_old_name, const String &p_new_name);
@@ -303,7 +342,6 @@ private:
 		real_t activity = 0.0;
 	};
 	mutable AHashMap<StringName, LocalVector<Activity>> input_activity_map;
-	mutable AHashMap<StringName, int> input_activity_map_get;
 
 	NodePath animation_player;
 
@@ -448,8 +448,35 @@ Variant Tween::interpolate_variant(const Variant &p_initial_val, const Variant &
 	ERR_FAIL_INDEX_V(p_trans, TransitionType::TRANS_MAX, Variant());
 	ERR_FAIL_INDEX_V(p_ease, EaseType::EASE_MAX, Variant());
 
+	const real_t t = run_equation(p_trans, p_ease, p_time, 0.0, 1.0, p_duration);
+
+	// Skip the generic add and interpolate dispatch for the most commonly tweened types, this runs for every PropertyTweener on every frame.
+	// Values are still read from and returned as Variant.
+	if (p_initial_val.get_type() == p_delta_val.get_type()) {
+		switch (p_initial_val.get_type()) {
+			case Variant::FLOAT: {
+				const double initial = p_initial_val;
+				return Math::lerp(initial, initial + p_delta_val.operator double(), (double)t);
+			}
+			case Variant::VECTOR2: {
+				const Vector2 initial = p_initial_val;
+				return initial.lerp(initial + p_delta_val.operator Vector2(), t);
+			}
+			case Variant::VECTOR3: {
+				const Vector3 initial = p_initial_val;
+				return initial.lerp(initial + p_delta_val.operator Vector3(), t);
+			}
+			case Variant::COLOR: {
+				const Color initial = p_initial_val;
+				return initial.lerp(initial + p_delta_val.operator Color(), t);
+			}
+			default: {
+			}
+		}
+	}
+
 	Variant ret = Animation::add_variant(p_initial_val, p_delta_val);
-	ret = Animation::interpolate_variant(p_initial_val, ret, run_equation(p_trans, p_ease, p_time, 0.0, 1.0, p_duration), p_initial_val.is_string());
+	ret = Animation::interpolate_variant(p_initial_val, ret, t, p_initial_val.is_string());
 	return ret;
 }
 
@@ -47,6 +47,9 @@
 int Node::orphan_node_count = 0;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
+#ifdef DEBUG_ENABLED
+bool Node::process_group_access_tracking = false;
+#endif
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -606,15 +609,8 @@ void Node::set_physics_process(bool p_process) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.physics_process = p_process;
-
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
+	_update_in_process_thread_group();
 }
 
 bool Node::is_physics_processing() const {
@@ -632,15 +628,8 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.physics_process_internal = p_process_internal;
-
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
+	_update_in_process_thread_group();
 }
 
 bool Node::is_physics_processing_internal() const {
@@ -1011,15 +1000,8 @@ void Node::set_process(bool p_process) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.process = p_process;
-
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
+	_update_in_process_thread_group();
 }
 
 bool Node::is_processing() const {
@@ -1037,16 +1019,17 @@ void Node::set_process_internal(bool p_process_internal) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.process_internal = p_process_internal;
+	_update_in_process_thread_group();
+}
 
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
+#ifdef DEBUG_ENABLED
+void Node::_record_process_group_access(bool p_write) const {
+	if (data.tree) {
+		data.tree->_record_process_group_access(current_process_thread_group, this, p_write);
 	}
 }
+#endif
 
 void Node::_add_process_group() {
 	data.tree->_add_process_group(this);
@@ -1064,6 +1047,10 @@ void Node::_add_to_process_thread_group() {
 	data.tree->_add_node_to_process_group(this, data.process_thread_group_owner);
 }
 
+void Node::_update_in_process_thread_group(bool p_priority_changed) {
+	data.tree->_update_node_in_process_group(this, data.process_thread_group_owner, p_priority_changed);
+}
+
 void Node::_remove_tree_from_process_thread_group() {
 	if (!is_inside_tree()) {
 		return; // May not be initialized yet.
@@ -1137,15 +1124,8 @@ void Node::set_process_priority(int p_priority) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.process_priority = p_priority;
-
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
+	_update_in_process_thread_group(true);
 }
 
 int Node::get_process_priority() const {
@@ -1163,15 +1143,8 @@ void Node::set_physics_process_priority(int p_priority) {
 		return;
 	}
 
-	if (_is_any_processing()) {
-		_remove_from_process_thread_group();
-	}
-
 	data.physics_process_priority = p_priority;
-
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
+	_update_in_process_thread_group(true);
 }
 
 int Node::get_physics_process_priority() const {
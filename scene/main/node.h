@@ -208,6 +208,10 @@ private:
 		int process_priority = 0;
 		int physics_process_priority = 0;
 
+		// Slots of the node in its process group dispatch lists, for constant time removal.
+		uint32_t process_slot = UINT32_MAX;
+		uint32_t physics_process_slot = UINT32_MAX;
+
 		// Keep bitpacked values together to get better packing.
 		ProcessMode process_mode : 3;
 		PhysicsInterpolationMode physics_interpolation_mode : 2;
@@ -322,11 +326,17 @@ private:
 	void _add_process_group();
 	void _remove_process_group();
 	void _add_to_process_thread_group();
+	void _update_in_process_thread_group(bool p_priority_changed = false);
 	void _remove_from_process_thread_group();
 	void _remove_tree_from_process_thread_group();
 	void _add_tree_to_process_thread_group(Node *p_owner);
 
 	static thread_local Node *current_process_thread_group;
+#ifdef DEBUG_ENABLED
+	// Set while thread groups are processed serially to record, instead of reject, accesses to nodes of other groups.
+	static bool process_group_access_tracking;
+	void _record_process_group_access(bool p_write) const;
+#endif
 
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -649,6 +659,12 @@ public:
 			return !data.tree || is_current_thread_safe_for_nodes();
 		} else {
 			// Thread processing.
+#ifdef DEBUG_ENABLED
+			if (unlikely(process_group_access_tracking) && current_process_thread_group != data.process_thread_group_owner) {
+				_record_process_group_access(true);
+				return true;
+			}
+#endif
 			return current_process_thread_group == data.process_thread_group_owner;
 		}
 	}
@@ -661,6 +677,11 @@ public:
 			return is_current_thread_safe_for_nodes() || unlikely(!data.tree);
 		} else {
 			// Thread processing.
+#ifdef DEBUG_ENABLED
+			if (unlikely(process_group_access_tracking) && current_process_thread_group != data.process_thread_group_owner) {
+				_record_process_group_access(false);
+			}
+#endif
 			return true;
 		}
 	}
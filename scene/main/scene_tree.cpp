@@ -171,10 +171,14 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
-	return &E->value;
+	Group &g = E->value;
+	ERR_FAIL_COND_V_MSG(g.indices.has(p_node), &g, "Already in group: " + p_group + ".");
+	g.indices.insert(p_node, g.nodes.size());
+	Group::Entry entry;
+	entry.node = p_node;
+	g.nodes.push_back(entry);
+	g.changed = true;
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -183,8 +187,30 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Group &g = E->value;
+	const uint32_t *index_ptr = g.indices.getptr(p_node);
+	if (!index_ptr) {
+		return;
+	}
+	const uint32_t index = *index_ptr;
+	g.indices.erase(p_node);
+
+	if (g.iterating > 0) {
+		// Keep the slots stable for the ongoing iteration, the group is compacted once it finishes.
+		g.nodes[index].node = nullptr;
+		g.removed_count++;
+		return;
+	}
+
+	const uint32_t last = g.nodes.size() - 1;
+	if (index != last) {
+		g.nodes[index] = g.nodes[last];
+		g.indices[g.nodes[index].node] = index;
+		g.unordered = true;
+	}
+	g.nodes.resize(last);
+
+	if (g.nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
@@ -329,238 +355,169 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
+bool SceneTree::Group::EntryTreeOrder::operator()(const Entry &p_a, const Entry &p_b) const {
+	return p_b.node->is_greater_than(p_a.node);
+}
+
 void SceneTree::_update_group_order(Group &g) {
-	if (!g.changed) {
+	if (!g.changed && !g.unordered) {
+		return;
+	}
+	if (g.iterating > 0) {
+		// Don't move nodes under an ongoing iteration, the next ordered request sorts them.
 		return;
 	}
 	if (g.nodes.is_empty()) {
 		return;
 	}
 
-	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
+	if (g.changed) {
+		g.nodes.sort_custom<Group::EntryTreeOrder>();
+		for (uint32_t i = 0; i < g.nodes.size(); i++) {
+			g.nodes[i].order = i;
+		}
+	} else {
+		// Only removals happened since the last full sort, so the cached keys still describe the tree order.
+		g.nodes.sort_custom<Group::EntryKeyOrder>();
+	}
 
-	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
+	for (uint32_t i = 0; i < g.nodes.size(); i++) {
+		g.indices[g.nodes[i].node] = i;
+	}
 
 	g.changed = false;
+	g.unordered = false;
 }
 
-void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
-	Vector<Node *> nodes_copy;
-
-	{
-		_THREAD_SAFE_METHOD_
-
-		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
-		if (!E) {
-			return;
-		}
-		Group &g = E->value;
-		if (g.nodes.is_empty()) {
-			return;
-		}
-
-		if (p_call_flags & GROUP_CALL_UNIQUE && p_call_flags & GROUP_CALL_DEFERRED) {
-			ERR_FAIL_COND(ugc_locked);
-
-			UGCall ug;
-			ug.call = p_function;
-			ug.group = p_group;
-
-			if (unique_group_calls.has(ug)) {
-				return;
-			}
-
-			Vector<Variant> args;
-			for (int i = 0; i < p_argcount; i++) {
-				args.push_back(*p_args[i]);
-			}
-
-			unique_group_calls[ug] = args;
-			return;
-		}
+SceneTree::Group *SceneTree::_lock_group(const StringName &p_group, bool p_ordered) {
+	_THREAD_SAFE_METHOD_
 
-		_update_group_order(g);
-		nodes_copy = g.nodes;
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (!E) {
+		return nullptr;
 	}
-
-	Node **gr_nodes = nodes_copy.ptrw();
-	int gr_node_count = nodes_copy.size();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
+	Group &g = E->value;
+	if (g.nodes.is_empty()) {
+		return nullptr;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			Node *node = gr_nodes[i];
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
-			} else {
-				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
-			}
-		}
-
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			Node *node = gr_nodes[i];
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
-			} else {
-				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
-			}
-		}
+	if (p_ordered) {
+		_update_group_order(g);
 	}
 
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
-		}
-	}
+	g.iterating++;
+	nodes_removed_on_group_call_lock++;
+	return &g;
 }
 
-void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
-	Vector<Node *> nodes_copy;
-	{
-		_THREAD_SAFE_METHOD_
-		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
-		if (!E) {
-			return;
-		}
-		Group &g = E->value;
-		if (g.nodes.is_empty()) {
-			return;
-		}
-
-		_update_group_order(g);
+void SceneTree::_unlock_group(const StringName &p_group, Group *p_group_data) {
+	_THREAD_SAFE_METHOD_
 
-		nodes_copy = g.nodes;
+	nodes_removed_on_group_call_lock--;
+	if (nodes_removed_on_group_call_lock == 0) {
+		nodes_removed_on_group_call.clear();
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
-	int gr_node_count = nodes_copy.size();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
+	Group &g = *p_group_data;
+	ERR_FAIL_COND(g.iterating == 0);
+	g.iterating--;
+	if (g.iterating > 0 || g.removed_count == 0) {
+		return;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->notification(p_notification, true);
-			} else {
-				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
-			}
+	// Compact the slots of nodes removed while iterating, keeping the relative order so a sorted group stays sorted.
+	uint32_t to = 0;
+	for (uint32_t from = 0; from < g.nodes.size(); from++) {
+		Node *node = g.nodes[from].node;
+		if (!node) {
+			continue;
 		}
-
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->notification(p_notification);
-			} else {
-				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
-			}
+		if (to != from) {
+			g.nodes[to] = g.nodes[from];
+			g.indices[node] = to;
 		}
+		to++;
 	}
+	g.nodes.resize(to);
+	g.removed_count = 0;
 
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
-		}
+	if (g.nodes.is_empty()) {
+		group_map.erase(p_group);
 	}
 }
 
-void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value) {
-	Vector<Node *> nodes_copy;
-	{
+void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	if (p_call_flags & GROUP_CALL_UNIQUE && p_call_flags & GROUP_CALL_DEFERRED) {
 		_THREAD_SAFE_METHOD_
 
 		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
 		}
-		Group &g = E->value;
-		if (g.nodes.is_empty()) {
+		if (E->value.nodes.is_empty()) {
 			return;
 		}
 
-		_update_group_order(g);
+		ERR_FAIL_COND(ugc_locked);
 
-		nodes_copy = g.nodes;
-	}
-	Node **gr_nodes = nodes_copy.ptrw();
-	int gr_node_count = nodes_copy.size();
+		UGCall ug;
+		ug.call = p_function;
+		ug.group = p_group;
 
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
-	}
-
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
-			} else {
-				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
-			}
+		if (unique_group_calls.has(ug)) {
+			return;
 		}
 
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
-			} else {
-				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
-			}
+		Vector<Variant> args;
+		for (int i = 0; i < p_argcount; i++) {
+			args.push_back(*p_args[i]);
 		}
-	}
 
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
-		}
+		unique_group_calls[ug] = args;
+		return;
 	}
+
+	for_each_node_in_group(
+			p_group, [&](Node *p_node) {
+				if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+					Callable::CallError ce;
+					p_node->callp(p_function, p_args, p_argcount, ce);
+					if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+						ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", p_node->get_name(), Variant::get_callable_error_text(Callable(p_node, p_function), p_args, p_argcount, ce)));
+					}
+				} else {
+					MessageQueue::get_singleton()->push_callp(p_node, p_function, p_args, p_argcount);
+				}
+				return true;
+			},
+			p_call_flags & GROUP_CALL_REVERSE);
+}
+
+void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
+	const bool reverse = p_call_flags & GROUP_CALL_REVERSE;
+	for_each_node_in_group(
+			p_group, [&](Node *p_node) {
+				if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+					p_node->notification(p_notification, reverse);
+				} else {
+					MessageQueue::get_singleton()->push_notification(p_node, p_notification);
+				}
+				return true;
+			},
+			reverse);
+}
+
+void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value) {
+	for_each_node_in_group(
+			p_group, [&](Node *p_node) {
+				if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+					p_node->set(p_name, p_value);
+				} else {
+					MessageQueue::get_singleton()->push_set(p_node, p_name, p_value);
+				}
+				return true;
+			},
+			p_call_flags & GROUP_CALL_REVERSE);
 }
 
 void SceneTree::notify_group(const StringName &p_group, int p_notification) {
@@ -713,6 +670,8 @@ bool SceneTree::process(double p_time) {
 		_flush_scene_change();
 	}
 
+	_process_async_instantiations();
+
 	process_timers(p_time, false); //go through timers
 	process_tweens(p_time, false);
 
@@ -812,34 +771,48 @@ void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
 	// This methods works similarly to how SceneTreeTimers are handled.
-	const List<Ref<Tween>>::Element *L = tweens.back();
+	// Tweens created while processing are appended after `count` and only processed on the next frame.
+	const uint32_t count = tweens.size();
 	const double unscaled_delta = Engine::get_singleton()->get_process_step();
 
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
-		Ref<Tween> &tween = E->get();
+	// Finished and removed tweens are dropped by moving the kept ones down, in a single pass.
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		if (tweens[i].is_null()) {
+			continue;
+		}
+
+		// Stepping may create tweens and reallocate the vector, so hold a reference rather than a pointer into it.
+		Ref<Tween> tween = tweens[i];
+		if (kept != i) {
+			tweens[kept] = tween;
+			tweens[i].unref();
+		}
 
 		// Don't process if paused or process mode doesn't match.
-		if (!tween->can_process(paused) || (p_physics == (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
+		if (tween->can_process(paused) && (p_physics != (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
+			if (!tween->step(tween->is_ignoring_time_scale() ? unscaled_delta : p_delta)) {
+				tween->clear();
+				tweens[kept].unref();
 			}
-			E = N;
-			continue;
 		}
 
-		if (!tween->step(tween->is_ignoring_time_scale() ? unscaled_delta : p_delta)) {
-			tween->clear();
-			tweens.erase(E);
+		if (tweens[kept].is_valid()) {
+			kept++;
 		}
-		if (E == L) {
-			break;
+	}
+
+	for (uint32_t i = count; i < tweens.size(); i++) {
+		if (tweens[i].is_valid()) {
+			tweens[kept++] = tweens[i];
 		}
-		E = N;
 	}
+	tweens.resize(kept);
 }
 
 void SceneTree::finalize() {
+	_clear_async_instantiations();
+
 	_flush_delete_queue();
 
 	_flush_ugc();
@@ -865,7 +838,9 @@ void SceneTree::finalize() {
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
-		tween->clear();
+		if (tween.is_valid()) {
+			tween->clear();
+		}
 	}
 	tweens.clear();
 }
@@ -960,6 +935,40 @@ void SceneTree::set_debug_navigation_hint(bool p_enabled) {
 bool SceneTree::is_debugging_navigation_hint() const {
 	return debug_navigation_hint;
 }
+
+void SceneTree::set_debug_process_thread_groups(bool p_enabled) {
+	_THREAD_SAFE_METHOD_
+	if (p_enabled && !debug_process_thread_groups) {
+		// Start a fresh recording.
+		for (ProcessGroup *pg : process_groups) {
+			pg->access_conflict = false;
+		}
+	}
+	debug_process_thread_groups = p_enabled;
+}
+
+bool SceneTree::is_debugging_process_thread_groups() const {
+	return debug_process_thread_groups;
+}
+
+void SceneTree::_record_process_group_access(Node *p_group_owner, const Node *p_node, bool p_write) {
+	ProcessGroup *pg = p_group_owner ? (ProcessGroup *)p_group_owner->data.process_group : nullptr;
+	if (!pg) {
+		return;
+	}
+
+	// Flag both groups first, as building the report below accesses the nodes again.
+	const bool first_conflict = !pg->access_conflict;
+	pg->access_conflict = true;
+	Node *other_owner = p_node->data.process_thread_group_owner;
+	if (other_owner && other_owner->data.process_group) {
+		((ProcessGroup *)other_owner->data.process_group)->access_conflict = true;
+	}
+
+	if (first_conflict) {
+		WARN_PRINT(vformat("Process thread group of node \"%s\" %s node \"%s\" from another group, which is a data race when both run in parallel. These groups will be processed on the main thread.", p_group_owner->get_path(), p_write ? "modifies" : "reads", p_node->get_path()));
+	}
+}
 #endif
 
 void SceneTree::set_debug_collisions_color(const Color &p_color) {
@@ -1146,39 +1155,75 @@ bool SceneTree::is_suspended() const {
 	return suspended;
 }
 
+void SceneTree::_compact_process_group(ProcessGroup *p_group, bool p_physics) {
+	LocalVector<ProcessGroup::Dispatch> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
+	uint32_t &removed = p_physics ? p_group->removed_physics_nodes : p_group->removed_nodes;
+	if (removed == 0) {
+		return;
+	}
+
+	// Keep the relative order, so a sorted list stays sorted.
+	uint32_t to = 0;
+	for (uint32_t from = 0; from < nodes.size(); from++) {
+		Node *n = nodes[from].node;
+		if (!n) {
+			continue;
+		}
+		if (to != from) {
+			nodes[to] = nodes[from];
+			(p_physics ? n->data.physics_process_slot : n->data.process_slot) = to;
+		}
+		to++;
+	}
+	nodes.resize(to);
+	removed = 0;
+}
+
+bool SceneTree::ProcessGroup::DispatchSort::operator()(const Dispatch &p_left, const Dispatch &p_right) const {
+	return physics ? Node::ComparatorWithPhysicsPriority()(p_left.node, p_right.node) : Node::ComparatorWithPriority()(p_left.node, p_right.node);
+}
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
 
 	p_group->call_queue.flush(); // Flush messages before processing.
 
-	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
+	// Compacting and sorting happen before processing only, nodes removed while processing just leave an empty slot.
+	_compact_process_group(p_group, p_physics);
+
+	LocalVector<ProcessGroup::Dispatch> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
 	if (nodes.is_empty()) {
 		return;
 	}
 
-	if (p_physics) {
-		if (p_group->physics_node_order_dirty) {
-			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
-			p_group->physics_node_order_dirty = false;
-		}
-	} else {
-		if (p_group->node_order_dirty) {
-			nodes.sort_custom<Node::ComparatorWithPriority>();
-			p_group->node_order_dirty = false;
+	bool &order_dirty = p_physics ? p_group->physics_node_order_dirty : p_group->node_order_dirty;
+	if (order_dirty) {
+		SortArray<ProcessGroup::Dispatch, ProcessGroup::DispatchSort> sorter;
+		sorter.compare.physics = p_physics;
+		sorter.sort(nodes.ptr(), nodes.size());
+		for (uint32_t i = 0; i < nodes.size(); i++) {
+			(p_physics ? nodes[i].node->data.physics_process_slot : nodes[i].node->data.process_slot) = i;
 		}
+		order_dirty = false;
 	}
 
-	// Make a copy, so if nodes are added/removed from process, this does not break
-	Vector<Node *> nodes_copy = nodes;
+	// Processing is still delivered through notification(), not through callbacks resolved per node:
+	// native classes, extensions and scripts can all handle these notifications in _notification().
+	const int internal_notification = p_physics ? Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS : Node::NOTIFICATION_INTERNAL_PROCESS;
+	const int notification = p_physics ? Node::NOTIFICATION_PHYSICS_PROCESS : Node::NOTIFICATION_PROCESS;
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	// Nodes added while processing are appended, and only processed from the next frame.
+	const uint32_t node_count = nodes.size();
 
 	for (uint32_t i = 0; i < node_count; i++) {
-		Node *n = nodes_ptr[i];
-		if (nodes_removed_on_group_call.has(n)) {
-			// Node may have been removed during process, skip it.
+		Node *n = nodes[i].node;
+		if (!n) {
+			// Node was removed during process, skip it.
+			continue;
+		}
+		if (!nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(n)) {
+			// Node may have been removed from the tree during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
 			continue;
 		}
@@ -1187,20 +1232,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			continue;
 		}
 
-		if (p_physics) {
-			if (n->is_physics_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
-			}
-			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
-			}
-		} else {
-			if (n->is_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
-			}
-			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+		if (nodes[i].flags & ProcessGroup::DISPATCH_INTERNAL) {
+			n->notification(internal_notification);
+			// The internal process may have changed the flags of the node, or removed it.
+			if (nodes[i].node == n && (nodes[i].flags & ProcessGroup::DISPATCH_PROCESS)) {
+				n->notification(notification);
 			}
+		} else if (nodes[i].flags & ProcessGroup::DISPATCH_PROCESS) {
+			n->notification(notification);
 		}
 	}
 
@@ -1273,17 +1312,30 @@ void SceneTree::_process(bool p_physics) {
 				}
 				for (uint32_t j = from; j < i; j++) {
 					if (process_groups[j]->last_pass == process_last_pass) {
-						if (using_threads) {
+						if (using_threads && !process_groups[j]->access_conflict) {
 							local_process_group_cache.push_back(process_groups[j]);
 						} else {
+							// Groups found to access other groups are processed on the main thread, where such accesses are safe.
 							_process_group(process_groups[j], p_physics);
 						}
 					}
 				}
 
-				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+				if (using_threads && !local_process_group_cache.is_empty()) {
+#ifdef DEBUG_ENABLED
+					if (debug_process_thread_groups) {
+						// Process the groups one at a time, so accesses to other groups can be recorded instead of racing.
+						Node::process_group_access_tracking = true;
+						for (uint32_t j = 0; j < local_process_group_cache.size(); j++) {
+							_process_groups_thread(j, p_physics);
+						}
+						Node::process_group_access_tracking = false;
+					} else
+#endif
+					{
+						WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
+						WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					}
 				}
 			}
 
@@ -1306,13 +1358,13 @@ void SceneTree::_process(bool p_physics) {
 		// Validate group for processing
 		bool process_valid = false;
 		if (p_physics) {
-			if (!pg->physics_nodes.is_empty()) {
+			if (pg->physics_nodes.size() > pg->removed_physics_nodes) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES_PHYSICS))) && pg->call_queue.has_messages()) {
 				process_valid = true;
 			}
 		} else {
-			if (!pg->nodes.is_empty()) {
+			if (pg->nodes.size() > pg->removed_nodes) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES))) && pg->call_queue.has_messages()) {
 				process_valid = true;
@@ -1373,14 +1425,18 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
-	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+	if (p_node->data.process_slot != UINT32_MAX) {
+		ERR_FAIL_COND(p_node->data.process_slot >= pg->nodes.size() || pg->nodes[p_node->data.process_slot].node != p_node);
+		pg->nodes[p_node->data.process_slot].node = nullptr;
+		pg->removed_nodes++;
+		p_node->data.process_slot = UINT32_MAX;
 	}
 
-	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+	if (p_node->data.physics_process_slot != UINT32_MAX) {
+		ERR_FAIL_COND(p_node->data.physics_process_slot >= pg->physics_nodes.size() || pg->physics_nodes[p_node->data.physics_process_slot].node != p_node);
+		pg->physics_nodes[p_node->data.physics_process_slot].node = nullptr;
+		pg->removed_physics_nodes++;
+		p_node->data.physics_process_slot = UINT32_MAX;
 	}
 }
 
@@ -1389,89 +1445,117 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		pg->nodes.push_back(p_node);
+		ERR_FAIL_COND(p_node->data.process_slot != UINT32_MAX);
+		ProcessGroup::Dispatch dispatch;
+		dispatch.node = p_node;
+		dispatch.flags = (p_node->is_processing_internal() ? ProcessGroup::DISPATCH_INTERNAL : 0) | (p_node->is_processing() ? ProcessGroup::DISPATCH_PROCESS : 0);
+		p_node->data.process_slot = pg->nodes.size();
+		pg->nodes.push_back(dispatch);
 		pg->node_order_dirty = true;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		pg->physics_nodes.push_back(p_node);
+		ERR_FAIL_COND(p_node->data.physics_process_slot != UINT32_MAX);
+		ProcessGroup::Dispatch dispatch;
+		dispatch.node = p_node;
+		dispatch.flags = (p_node->is_physics_processing_internal() ? ProcessGroup::DISPATCH_INTERNAL : 0) | (p_node->is_physics_processing() ? ProcessGroup::DISPATCH_PROCESS : 0);
+		p_node->data.physics_process_slot = pg->physics_nodes.size();
+		pg->physics_nodes.push_back(dispatch);
 		pg->physics_node_order_dirty = true;
 	}
 }
 
-void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
-	Vector<Node *> nodes_copy;
-	{
-		_THREAD_SAFE_METHOD_
+void SceneTree::_update_node_in_process_group(Node *p_node, Node *p_owner, bool p_priority_changed) {
+	_THREAD_SAFE_METHOD_
+	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
-		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
-		if (!E) {
-			return;
-		}
-		Group &g = E->value;
-		if (g.nodes.is_empty()) {
-			return;
+	// Nodes keep their slot, so one already in the list is still processed this frame (with its new flags), and sorted again from the next one.
+	if (p_node->is_processing() || p_node->is_processing_internal()) {
+		const uint32_t flags = (p_node->is_processing_internal() ? ProcessGroup::DISPATCH_INTERNAL : 0) | (p_node->is_processing() ? ProcessGroup::DISPATCH_PROCESS : 0);
+		if (p_node->data.process_slot == UINT32_MAX) {
+			ProcessGroup::Dispatch dispatch;
+			dispatch.node = p_node;
+			dispatch.flags = flags;
+			p_node->data.process_slot = pg->nodes.size();
+			pg->nodes.push_back(dispatch);
+			pg->node_order_dirty = true;
+		} else {
+			ERR_FAIL_COND(p_node->data.process_slot >= pg->nodes.size() || pg->nodes[p_node->data.process_slot].node != p_node);
+			pg->nodes[p_node->data.process_slot].flags = flags;
+			pg->node_order_dirty = pg->node_order_dirty || p_priority_changed;
 		}
-
-		_update_group_order(g);
-
-		//copy, so copy on write happens in case something is removed from process while being called
-		//performance is not lost because only if something is added/removed the vector is copied.
-		nodes_copy = g.nodes;
+	} else if (p_node->data.process_slot != UINT32_MAX) {
+		ERR_FAIL_COND(p_node->data.process_slot >= pg->nodes.size() || pg->nodes[p_node->data.process_slot].node != p_node);
+		pg->nodes[p_node->data.process_slot].node = nullptr;
+		pg->removed_nodes++;
+		p_node->data.process_slot = UINT32_MAX;
 	}
 
-	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
+	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+		const uint32_t flags = (p_node->is_physics_processing_internal() ? ProcessGroup::DISPATCH_INTERNAL : 0) | (p_node->is_physics_processing() ? ProcessGroup::DISPATCH_PROCESS : 0);
+		if (p_node->data.physics_process_slot == UINT32_MAX) {
+			ProcessGroup::Dispatch dispatch;
+			dispatch.node = p_node;
+			dispatch.flags = flags;
+			p_node->data.physics_process_slot = pg->physics_nodes.size();
+			pg->physics_nodes.push_back(dispatch);
+			pg->physics_node_order_dirty = true;
+		} else {
+			ERR_FAIL_COND(p_node->data.physics_process_slot >= pg->physics_nodes.size() || pg->physics_nodes[p_node->data.physics_process_slot].node != p_node);
+			pg->physics_nodes[p_node->data.physics_process_slot].flags = flags;
+			pg->physics_node_order_dirty = pg->physics_node_order_dirty || p_priority_changed;
+		}
+	} else if (p_node->data.physics_process_slot != UINT32_MAX) {
+		ERR_FAIL_COND(p_node->data.physics_process_slot >= pg->physics_nodes.size() || pg->physics_nodes[p_node->data.physics_process_slot].node != p_node);
+		pg->physics_nodes[p_node->data.physics_process_slot].node = nullptr;
+		pg->removed_physics_nodes++;
+		p_node->data.physics_process_slot = UINT32_MAX;
 	}
+}
 
+void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	Vector<ObjectID> no_context_node_ids; // Nodes may be deleted due to this shortcut input.
 
-	for (int i = gr_node_count - 1; i >= 0; i--) {
-		if (p_viewport->is_input_handled()) {
-			break;
-		}
-
-		Node *n = gr_nodes[i];
-		if (nodes_removed_on_group_call.has(n)) {
-			continue;
-		}
+	for_each_node_in_group(
+			p_group, [&](Node *n) {
+				if (p_viewport->is_input_handled()) {
+					return false;
+				}
 
-		if (!n->can_process()) {
-			continue;
-		}
+				if (!n->can_process()) {
+					return true;
+				}
 
-		switch (p_call_type) {
-			case CALL_INPUT_TYPE_INPUT:
-				n->_call_input(p_input);
-				break;
-			case CALL_INPUT_TYPE_SHORTCUT_INPUT: {
-				const Control *c = Object::cast_to<Control>(n);
-				if (c) {
-					// If calling shortcut input on a control, ensure it respects the shortcut context.
-					// Shortcut context (based on focus) only makes sense for controls (UI), so don't need to worry about it for nodes
-					if (c->get_shortcut_context() == nullptr) {
-						no_context_node_ids.append(n->get_instance_id());
-						continue;
-					}
-					if (!c->is_focus_owner_in_shortcut_context()) {
-						continue;
+				switch (p_call_type) {
+					case CALL_INPUT_TYPE_INPUT:
+						n->_call_input(p_input);
+						break;
+					case CALL_INPUT_TYPE_SHORTCUT_INPUT: {
+						const Control *c = Object::cast_to<Control>(n);
+						if (c) {
+							// If calling shortcut input on a control, ensure it respects the shortcut context.
+							// Shortcut context (based on focus) only makes sense for controls (UI), so don't need to worry about it for nodes
+							if (c->get_shortcut_context() == nullptr) {
+								no_context_node_ids.append(n->get_instance_id());
+								return true;
+							}
+							if (!c->is_focus_owner_in_shortcut_context()) {
+								return true;
+							}
+						}
+						n->_call_shortcut_input(p_input);
+						break;
 					}
+					case CALL_INPUT_TYPE_UNHANDLED_INPUT:
+						n->_call_unhandled_input(p_input);
+						break;
+					case CALL_INPUT_TYPE_UNHANDLED_KEY_INPUT:
+						n->_call_unhandled_key_input(p_input);
+						break;
 				}
-				n->_call_shortcut_input(p_input);
-				break;
-			}
-			case CALL_INPUT_TYPE_UNHANDLED_INPUT:
-				n->_call_unhandled_input(p_input);
-				break;
-			case CALL_INPUT_TYPE_UNHANDLED_KEY_INPUT:
-				n->_call_unhandled_key_input(p_input);
-				break;
-		}
-	}
+				return true;
+			},
+			true);
 
 	for (const ObjectID &id : no_context_node_ids) {
 		if (p_viewport->is_input_handled()) {
@@ -1482,14 +1566,6 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			n->_call_shortcut_input(p_input);
 		}
 	}
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
-		}
-	}
 }
 
 void SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
@@ -1533,16 +1609,18 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	}
 
 	_update_group_order(E->value); //update order just in case
-	int nc = E->value.nodes.size();
+	int nc = E->value.get_node_count();
 	if (nc == 0) {
 		return ret;
 	}
 
 	ret.resize(nc);
 
-	Node **ptr = E->value.nodes.ptrw();
-	for (int i = 0; i < nc; i++) {
-		ret[i] = ptr[i];
+	int i = 0;
+	for (const Group::Entry &entry : E->value.nodes) {
+		if (entry.node) {
+			ret[i++] = entry.node;
+		}
 	}
 
 	return ret;
@@ -1560,7 +1638,7 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 		return 0;
 	}
 
-	return E->value.nodes.size();
+	return E->value.get_node_count();
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
@@ -1572,11 +1650,13 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 
 	_update_group_order(E->value); // Update order just in case.
 
-	if (E->value.nodes.is_empty()) {
-		return nullptr;
+	for (const Group::Entry &entry : E->value.nodes) {
+		if (entry.node) {
+			return entry.node;
+		}
 	}
 
-	return E->value.nodes[0];
+	return nullptr;
 }
 
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
@@ -1587,13 +1667,10 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	}
 
 	_update_group_order(E->value); //update order just in case
-	int nc = E->value.nodes.size();
-	if (nc == 0) {
-		return;
-	}
-	Node **ptr = E->value.nodes.ptrw();
-	for (int i = 0; i < nc; i++) {
-		p_list->push_back(ptr[i]);
+	for (const Group::Entry &entry : E->value.nodes) {
+		if (entry.node) {
+			p_list->push_back(entry.node);
+		}
 	}
 }
 
@@ -1754,9 +1831,10 @@ Ref<Tween> SceneTree::create_tween() {
 
 void SceneTree::remove_tween(const Ref<Tween> &p_tween) {
 	_THREAD_SAFE_METHOD_
-	for (List<Ref<Tween>>::Element *E = tweens.back(); E; E = E->prev()) {
-		if (E->get() == p_tween) {
-			E->erase();
+	for (int64_t i = int64_t(tweens.size()) - 1; i >= 0; i--) {
+		if (tweens[i] == p_tween) {
+			// Only cleared, as this may be called while the tweens are being processed.
+			tweens[i].unref();
 			break;
 		}
 	}
@@ -1765,17 +1843,141 @@ void SceneTree::remove_tween(const Ref<Tween> &p_tween) {
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Tween> ret;
-	ret.resize(tweens.size());
-
-	int i = 0;
 	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+		if (tween.is_valid()) {
+			ret.push_back(tween);
+		}
 	}
 
 	return ret;
 }
 
+struct SceneTree::AsyncInstantiation {
+	Ref<PackedScene> scene;
+	ObjectID parent;
+	Callable callback;
+	int count = 0;
+
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	LocalVector<Node *> nodes; // Detached trees built by the worker thread.
+	LocalVector<ObjectID> committed;
+};
+
+void SceneTree::_instantiate_async_task(void *p_userdata) {
+	AsyncInstantiation *ai = (AsyncInstantiation *)p_userdata;
+	ai->nodes.reserve(ai->count);
+	for (int i = 0; i < ai->count; i++) {
+		// Nodes outside the tree can be built from any thread, only adding them to the tree needs the main thread.
+		Node *node = ai->scene->instantiate();
+		if (!node) {
+			break;
+		}
+		ai->nodes.push_back(node);
+	}
+}
+
+void SceneTree::instantiate_async(const Ref<PackedScene> &p_scene, Node *p_parent, int p_count, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "Asynchronous instantiation can only be requested from the main thread.");
+	ERR_FAIL_COND(p_scene.is_null());
+	ERR_FAIL_COND(!p_scene->can_instantiate());
+	ERR_FAIL_NULL(p_parent);
+	ERR_FAIL_COND(p_count <= 0);
+
+	AsyncInstantiation *ai = memnew(AsyncInstantiation);
+	ai->scene = p_scene;
+	ai->parent = p_parent->get_instance_id();
+	ai->callback = p_callback;
+	ai->count = p_count;
+	ai->task_id = WorkerThreadPool::get_singleton()->add_native_task(&SceneTree::_instantiate_async_task, ai, false, SNAME("SceneTreeInstantiateAsync"));
+	async_instantiations.push_back(ai);
+}
+
+void SceneTree::_process_async_instantiations() {
+	if (async_instantiations.is_empty()) {
+		return;
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	bool budget_left = true;
+
+	while (budget_left && !async_instantiations.is_empty()) {
+		AsyncInstantiation *ai = async_instantiations[0];
+		if (ai->task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			if (!WorkerThreadPool::get_singleton()->is_task_completed(ai->task_id)) {
+				break; // Requests are committed in order, wait for the worker.
+			}
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(ai->task_id);
+			ai->task_id = WorkerThreadPool::INVALID_TASK_ID;
+		}
+
+		Node *parent = ObjectDB::get_instance<Node>(ai->parent);
+		uint32_t next = ai->committed.size();
+		while (next < ai->nodes.size()) {
+			Node *node = ai->nodes[next++];
+			if (!parent) {
+				// The parent is gone, nothing left to commit to.
+				memdelete(node);
+				ai->committed.push_back(ObjectID());
+				continue;
+			}
+
+			// Entering the tree and `_ready()` happen here, on the main thread.
+			ai->committed.push_back(node->get_instance_id());
+			parent->add_child(node);
+
+			if (OS::get_singleton()->get_ticks_usec() - begin >= (uint64_t)async_instantiation_budget_usec) {
+				// At least one node is committed per frame, so requests always make progress.
+				budget_left = false;
+				break;
+			}
+		}
+
+		if (next < ai->nodes.size()) {
+			break;
+		}
+
+		async_instantiations.remove_at(0);
+
+		if (ai->callback.is_valid()) {
+			TypedArray<Node> nodes;
+			for (const ObjectID &id : ai->committed) {
+				Node *node = ObjectDB::get_instance<Node>(id);
+				if (node) {
+					nodes.push_back(node);
+				}
+			}
+			ai->callback.call(nodes);
+		}
+
+		memdelete(ai);
+	}
+}
+
+void SceneTree::_clear_async_instantiations() {
+	for (AsyncInstantiation *ai : async_instantiations) {
+		if (ai->task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(ai->task_id);
+		}
+		for (uint32_t i = ai->committed.size(); i < ai->nodes.size(); i++) {
+			memdelete(ai->nodes[i]);
+		}
+		memdelete(ai);
+	}
+	async_instantiations.clear();
+}
+
+int SceneTree::get_pending_async_instantiation_count() const {
+	return async_instantiations.size();
+}
+
+void SceneTree::set_async_instantiation_budget_usec(int p_usec) {
+	async_instantiation_budget_usec = MAX(p_usec, 0);
+}
+
+int SceneTree::get_async_instantiation_budget_usec() const {
+	return async_instantiation_budget_usec;
+}
+
 Ref<MultiplayerAPI> SceneTree::get_multiplayer(const NodePath &p_for_path) const {
 	ERR_FAIL_COND_V_MSG(!Thread::is_main_thread(), Ref<MultiplayerAPI>(), "Multiplayer can only be manipulated from the main thread.");
 	if (p_for_path.is_empty()) {
@@ -1872,6 +2074,8 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_debugging_paths_hint"), &SceneTree::is_debugging_paths_hint);
 	ClassDB::bind_method(D_METHOD("set_debug_navigation_hint", "enable"), &SceneTree::set_debug_navigation_hint);
 	ClassDB::bind_method(D_METHOD("is_debugging_navigation_hint"), &SceneTree::is_debugging_navigation_hint);
+	ClassDB::bind_method(D_METHOD("set_debug_process_thread_groups", "enable"), &SceneTree::set_debug_process_thread_groups);
+	ClassDB::bind_method(D_METHOD("is_debugging_process_thread_groups"), &SceneTree::is_debugging_process_thread_groups);
 
 	ClassDB::bind_method(D_METHOD("set_edited_scene_root", "scene"), &SceneTree::set_edited_scene_root);
 	ClassDB::bind_method(D_METHOD("get_edited_scene_root"), &SceneTree::get_edited_scene_root);
@@ -1883,6 +2087,11 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_tween"), &SceneTree::create_tween);
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
 
+	ClassDB::bind_method(D_METHOD("instantiate_async", "scene", "parent", "count", "callback"), &SceneTree::instantiate_async, DEFVAL(1), DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("get_pending_async_instantiation_count"), &SceneTree::get_pending_async_instantiation_count);
+	ClassDB::bind_method(D_METHOD("set_async_instantiation_budget_usec", "usec"), &SceneTree::set_async_instantiation_budget_usec);
+	ClassDB::bind_method(D_METHOD("get_async_instantiation_budget_usec"), &SceneTree::get_async_instantiation_budget_usec);
+
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
 	ClassDB::bind_method(D_METHOD("quit", "exit_code"), &SceneTree::quit, DEFVAL(EXIT_SUCCESS));
@@ -1932,10 +2141,12 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_multiplayer_poll_enabled"), &SceneTree::is_multiplayer_poll_enabled);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_accept_quit"), "set_auto_accept_quit", "is_auto_accept_quit");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "async_instantiation_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), "set_async_instantiation_budget_usec", "get_async_instantiation_budget_usec");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "quit_on_go_back"), "set_quit_on_go_back", "is_quit_on_go_back");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_collisions_hint"), "set_debug_collisions_hint", "is_debugging_collisions_hint");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_paths_hint"), "set_debug_paths_hint", "is_debugging_paths_hint");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_navigation_hint"), "set_debug_navigation_hint", "is_debugging_navigation_hint");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_process_thread_groups"), "set_debug_process_thread_groups", "is_debugging_process_thread_groups");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "paused"), "set_pause", "is_paused");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "edited_scene_root", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_edited_scene_root", "get_edited_scene_root");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "current_scene", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_current_scene", "get_current_scene");
@@ -32,6 +32,7 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
 #include "scene/main/scene_tree_fti.h"
@@ -91,9 +92,29 @@ private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
 
 	struct ProcessGroup {
+		// Processing notifications to send to a node, resolved when it is added to the group
+		// and updated in place whenever its processing flags change.
+		enum {
+			DISPATCH_INTERNAL = 1,
+			DISPATCH_PROCESS = 2,
+		};
+
+		struct Dispatch {
+			Node *node = nullptr; // Null once removed, until the list is compacted.
+			uint32_t flags = 0;
+		};
+
+		struct DispatchSort {
+			bool physics = false;
+			_FORCE_INLINE_ bool operator()(const Dispatch &p_left, const Dispatch &p_right) const;
+		};
+
 		CallQueue call_queue;
-		Vector<Node *> nodes;
-		Vector<Node *> physics_nodes;
+		LocalVector<Dispatch> nodes;
+		LocalVector<Dispatch> physics_nodes;
+		uint32_t removed_nodes = 0;
+		uint32_t removed_physics_nodes = 0;
+		bool access_conflict = false; // Seen accessing nodes of another group (or accessed by one) while debugging process thread groups, so it isn't run in parallel.
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
@@ -117,8 +138,27 @@ private:
 	bool node_threading_disabled = false;
 
 	struct Group {
-		Vector<Node *> nodes;
-		bool changed = false;
+		struct Entry {
+			Node *node = nullptr; // Null while a removed node's slot waits for the group to be compacted.
+			uint32_t order = 0; // Tree order key, only valid while `changed` is false.
+		};
+
+		struct EntryTreeOrder {
+			_FORCE_INLINE_ bool operator()(const Entry &p_a, const Entry &p_b) const;
+		};
+
+		struct EntryKeyOrder {
+			_FORCE_INLINE_ bool operator()(const Entry &p_a, const Entry &p_b) const { return p_a.order < p_b.order; }
+		};
+
+		LocalVector<Entry> nodes;
+		AHashMap<Node *, uint32_t> indices; // Slot of each node in `nodes`, for constant time membership checks and removal.
+		uint32_t removed_count = 0;
+		uint32_t iterating = 0;
+		bool changed = false; // Nodes were added or moved, needs a full tree order sort.
+		bool unordered = false; // Nodes were swap-removed, sorting by the cached order keys is enough.
+
+		uint32_t get_node_count() const { return indices.size(); }
 	};
 
 #ifndef _3D_DISABLED
@@ -139,6 +179,7 @@ private:
 	bool debug_collisions_hint = false;
 	bool debug_paths_hint = false;
 	bool debug_navigation_hint = false;
+	bool debug_process_thread_groups = false;
 #endif
 	bool paused = false;
 	bool suspended = false;
@@ -195,6 +236,8 @@ private:
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(Group &g);
+	Group *_lock_group(const StringName &p_group, bool p_ordered);
+	void _unlock_group(const StringName &p_group, Group *p_group_data);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -214,7 +257,15 @@ private:
 	void _flush_scene_change();
 
 	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	LocalVector<Ref<Tween>> tweens; // Removed tweens are left as null entries until the next process_tweens() compacts them.
+
+	struct AsyncInstantiation;
+	LocalVector<AsyncInstantiation *> async_instantiations; // Committed in request order.
+	int async_instantiation_budget_usec = 2000;
+
+	static void _instantiate_async_task(void *p_userdata);
+	void _process_async_instantiations();
+	void _clear_async_instantiations();
 
 	///network///
 
@@ -235,6 +286,10 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
+	void _compact_process_group(ProcessGroup *p_group, bool p_physics);
+#ifdef DEBUG_ENABLED
+	void _record_process_group_access(Node *p_group_owner, const Node *p_node, bool p_write);
+#endif
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
@@ -243,6 +298,7 @@ private:
 	void _add_process_group(Node *p_node);
 	void _remove_node_from_process_group(Node *p_node, Node *p_owner);
 	void _add_node_to_process_group(Node *p_node, Node *p_owner);
+	void _update_node_in_process_group(Node *p_node, Node *p_owner, bool p_priority_changed = false);
 
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -373,6 +429,9 @@ public:
 
 	void set_debug_navigation_hint(bool p_enabled);
 	bool is_debugging_navigation_hint() const;
+
+	void set_debug_process_thread_groups(bool p_enabled);
+	bool is_debugging_process_thread_groups() const;
 #else
 	void set_debug_collisions_hint(bool p_enabled) {}
 	bool is_debugging_collisions_hint() const { return false; }
@@ -382,6 +441,9 @@ public:
 
 	void set_debug_navigation_hint(bool p_enabled) {}
 	bool is_debugging_navigation_hint() const { return false; }
+
+	void set_debug_process_thread_groups(bool p_enabled) {}
+	bool is_debugging_process_thread_groups() const { return false; }
 #endif
 
 	void set_debug_collisions_color(const Color &p_color);
@@ -409,6 +471,35 @@ public:
 	void queue_delete(Object *p_object);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
+
+	// Calls `p_func` with each node in the group until it returns false, in tree order (unless `p_ordered` is false) and without copying the group.
+	// Nodes removed from the group while iterating are skipped, nodes added while iterating are not visited.
+	template <typename F>
+	void for_each_node_in_group(const StringName &p_group, F &&p_func, bool p_reverse = false, bool p_ordered = true) {
+		Group *g = _lock_group(p_group, p_ordered);
+		if (!g) {
+			return;
+		}
+		const uint32_t count = g->nodes.size();
+		for (uint32_t i = 0; i < count; i++) {
+			Node *node;
+			{
+				// Other threads may add nodes to the group, which can reallocate it. Slots are never moved while iterating.
+				_THREAD_SAFE_METHOD_
+				node = g->nodes[p_reverse ? count - 1 - i : i].node;
+				if (node && !nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(node)) {
+					node = nullptr;
+				}
+			}
+			if (!node) {
+				continue;
+			}
+			if (!p_func(node)) {
+				break;
+			}
+		}
+		_unlock_group(p_group, g);
+	}
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
 	int get_node_count_in_group(const StringName &p_group) const;
@@ -431,6 +522,11 @@ public:
 	void remove_tween(const Ref<Tween> &p_tween);
 	TypedArray<Tween> get_processed_tweens();
 
+	void instantiate_async(const Ref<PackedScene> &p_scene, Node *p_parent, int p_count = 1, const Callable &p_callback = Callable());
+	int get_pending_async_instantiation_count() const;
+	void set_async_instantiation_budget_usec(int p_usec);
+	int get_async_instantiation_budget_usec() const;
+
 	//used by Main::start, don't use otherwise
 	void add_current_scene(Node *p_current);
 
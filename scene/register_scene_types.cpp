@@ -215,6 +215,7 @@
 
 #ifndef _3D_DISABLED
 #include "scene/3d/aim_modifier_3d.h"
+#include "scene/3d/animation_texture_baker.h"
 #include "scene/3d/audio_listener_3d.h"
 #include "scene/3d/audio_stream_player_3d.h"
 #include "scene/3d/bone_attachment_3d.h"
@@ -595,6 +596,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Skin);
 	GDREGISTER_ABSTRACT_CLASS(SkinReference);
 	GDREGISTER_CLASS(Skeleton3D);
+	GDREGISTER_CLASS(AnimationTextureBaker);
 	GDREGISTER_CLASS(ImporterMesh);
 	GDREGISTER_CLASS(ImporterMeshInstance3D);
 	GDREGISTER_VIRTUAL_CLASS(VisualInstance3D);
@@ -148,6 +148,7 @@ void HeightMapShape3D::_update_shape() {
 	d["heights"] = map_data;
 	d["min_height"] = min_height;
 	d["max_height"] = max_height;
+	d["half_precision"] = half_precision;
 	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
 	Shape3D::_update_shape();
 }
@@ -243,6 +244,20 @@ real_t HeightMapShape3D::get_max_height() const {
 	return max_height;
 }
 
+void HeightMapShape3D::set_half_precision(bool p_enabled) {
+	if (half_precision == p_enabled) {
+		return;
+	}
+
+	half_precision = p_enabled;
+	_update_shape();
+	emit_changed();
+}
+
+bool HeightMapShape3D::is_half_precision() const {
+	return half_precision;
+}
+
 void HeightMapShape3D::update_map_data_from_image(const Ref<Image> &p_image, real_t p_height_min, real_t p_height_max) {
 	ERR_FAIL_COND_MSG(p_image.is_null(), "Heightmap update image requires a valid Image reference.");
 	ERR_FAIL_COND_MSG(p_image->get_format() != Image::FORMAT_RF && p_image->get_format() != Image::FORMAT_RH && p_image->get_format() != Image::FORMAT_R8, "Heightmap update image requires Image in format FORMAT_RF (32 bit), FORMAT_RH (16 bit), or FORMAT_R8 (8 bit).");
@@ -341,6 +356,56 @@ void HeightMapShape3D::update_map_data_from_image(const Ref<Image> &p_image, rea
 	emit_changed();
 }
 
+void HeightMapShape3D::update_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data) {
+	ERR_FAIL_COND_MSG(p_region.size.x <= 0 || p_region.size.y <= 0, "Heightmap update region must not be empty.");
+	ERR_FAIL_COND_MSG(p_region.position.x < 0 || p_region.position.y < 0 || p_region.get_end().x > map_width || p_region.get_end().y > map_depth, "Heightmap update region must be inside of the map.");
+	ERR_FAIL_COND_MSG(p_data.size() != p_region.size.x * p_region.size.y, "Heightmap update region data size must be equal to the region width multiplied by its depth.");
+
+	real_t *w = map_data.ptrw();
+	const real_t *r = p_data.ptr();
+
+	// If the current extremes are overwritten, the whole map has to be scanned again.
+	bool rescan = false;
+	real_t region_min_height = r[0];
+	real_t region_max_height = r[0];
+
+	for (int z = 0; z < p_region.size.y; z++) {
+		for (int x = 0; x < p_region.size.x; x++) {
+			real_t &height = w[(p_region.position.y + z) * map_width + p_region.position.x + x];
+			if (height == min_height || height == max_height) {
+				rescan = true;
+			}
+
+			height = r[z * p_region.size.x + x];
+			region_min_height = MIN(region_min_height, height);
+			region_max_height = MAX(region_max_height, height);
+		}
+	}
+
+	if (rescan) {
+		min_height = map_data[0];
+		max_height = map_data[0];
+		for (int i = 1; i < map_data.size(); i++) {
+			min_height = MIN(min_height, map_data[i]);
+			max_height = MAX(max_height, map_data[i]);
+		}
+	} else {
+		min_height = MIN(min_height, region_min_height);
+		max_height = MAX(max_height, region_max_height);
+	}
+
+	// Only send the region to the physics server, so it can patch its copy in place.
+	Dictionary d;
+	d["width"] = map_width;
+	d["depth"] = map_depth;
+	d["region"] = p_region;
+	d["heights"] = p_data;
+	d["min_height"] = min_height;
+	d["max_height"] = max_height;
+	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
+	Shape3D::_update_shape();
+}
+
 void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_map_width", "width"), &HeightMapShape3D::set_map_width);
 	ClassDB::bind_method(D_METHOD("get_map_width"), &HeightMapShape3D::get_map_width);
@@ -350,12 +415,16 @@ void HeightMapShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_map_data"), &HeightMapShape3D::get_map_data);
 	ClassDB::bind_method(D_METHOD("get_min_height"), &HeightMapShape3D::get_min_height);
 	ClassDB::bind_method(D_METHOD("get_max_height"), &HeightMapShape3D::get_max_height);
+	ClassDB::bind_method(D_METHOD("set_half_precision", "enabled"), &HeightMapShape3D::set_half_precision);
+	ClassDB::bind_method(D_METHOD("is_half_precision"), &HeightMapShape3D::is_half_precision);
 
 	ClassDB::bind_method(D_METHOD("update_map_data_from_image", "image", "height_min", "height_max"), &HeightMapShape3D::update_map_data_from_image);
+	ClassDB::bind_method(D_METHOD("update_map_data_region", "region", "data"), &HeightMapShape3D::update_map_data_region);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_width", PROPERTY_HINT_RANGE, "1,100,1,or_greater"), "set_map_width", "get_map_width");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "map_depth", PROPERTY_HINT_RANGE, "1,100,1,or_greater"), "set_map_depth", "get_map_depth");
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "map_data"), "set_map_data", "get_map_data");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "half_precision"), "set_half_precision", "is_half_precision");
 }
 
 HeightMapShape3D::HeightMapShape3D() :
@@ -43,6 +43,7 @@ class HeightMapShape3D : public Shape3D {
 	Vector<real_t> map_data;
 	real_t min_height = 0.0;
 	real_t max_height = 0.0;
+	bool half_precision = false;
 
 protected:
 	static void _bind_methods();
@@ -59,7 +60,11 @@ public:
 	real_t get_min_height() const;
 	real_t get_max_height() const;
 
+	void set_half_precision(bool p_enabled);
+	bool is_half_precision() const;
+
 	void update_map_data_from_image(const Ref<Image> &p_image, real_t p_height_min, real_t p_height_max);
+	void update_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data);
 
 	virtual Vector<Vector3> get_debug_mesh_lines() const override;
 	virtual Ref<ArrayMesh> get_debug_arraymesh_faces(const Color &p_modulate) const override;
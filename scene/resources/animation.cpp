@@ -4853,24 +4853,25 @@ struct AnimationCompressionBufferBitsRead {
 	uint32_t used = 0;
 	const uint8_t *src_data = nullptr;
 
+	// Reads at most 16 bits, which is the widest field in the format.
+	// Whole bytes are shifted into the buffer as needed, so no more bytes are consumed than the bits require.
 	_FORCE_INLINE_ uint32_t read(uint32_t p_bits) {
-		uint32_t output = 0;
-		uint32_t written = 0;
-		while (p_bits > 0) {
-			if (used == 0) {
-				used = 8;
-				buffer = *src_data;
-				src_data++;
-			}
-			uint32_t to_write = MIN(used, p_bits);
-			output |= (buffer & ((1 << to_write) - 1)) << written;
-			buffer >>= to_write;
-			used -= to_write;
-			p_bits -= to_write;
-			written += to_write;
-		}
+		while (used < p_bits) {
+			buffer |= uint32_t(*src_data) << used;
+			src_data++;
+			used += 8;
+		}
+		uint32_t output = buffer & ((1u << p_bits) - 1);
+		buffer >>= p_bits;
+		used -= p_bits;
 		return output;
 	}
+
+	_FORCE_INLINE_ int16_t read_delta(uint32_t p_bit_width) {
+		uint32_t valueu = read(p_bit_width + 1);
+		int16_t value = valueu & ((1 << p_bit_width) - 1);
+		return (valueu & (1 << p_bit_width)) ? -value - 1 : value;
+	}
 };
 
 void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tolerance) {
@@ -5347,15 +5348,20 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	// Pages are sorted by time offset, find the last one starting at or before the requested time.
+	uint32_t page_low = 0;
+	uint32_t page_high = compression.pages.size();
+	while (page_low < page_high) {
+		uint32_t middle = (page_low + page_high) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			page_high = middle;
+		} else {
+			page_low = middle + 1;
 		}
-		page_index = i;
 	}
 
-	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+	ERR_FAIL_COND_V(page_low == 0, false); //should not happen
+	int32_t page_index = page_low - 1;
 
 	double page_base_time = compression.pages[page_index].time_offset;
 	const uint8_t *page_data = compression.pages[page_index].data.ptr();
@@ -5364,25 +5370,26 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
-	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
-
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
-
-		if (frame_time > p_time) {
-			break;
+	// Same for the time keys within the page, the first one is always used as a fallback.
+	uint32_t key_low = 1;
+	uint32_t key_high = MAX(time_key_count, 1u);
+	while (key_low < key_high) {
+		uint32_t middle = (key_low + key_high) / 2;
+		if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+			key_high = middle;
+		} else {
+			key_low = middle + 1;
 		}
+	}
 
-		if (key_index) {
-			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
+	int32_t packet_idx = key_low - 1;
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
+	double packet_time = double(base_frame) * frame_to_sec + page_base_time;
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+	if (key_index) {
+		for (int32_t i = 0; i < packet_idx; i++) {
+			(*key_index) += (time_keys[i * 2 + 1] >> 12) + 1;
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
@@ -5425,14 +5432,7 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 					if (bit_width[j] == 0) {
 						continue; // do none
 					}
-					uint32_t valueu = buffer.read(bit_width[j] + 1);
-					bool sign = valueu & (1 << bit_width[j]);
-					int16_t value = valueu & ((1 << bit_width[j]) - 1);
-					if (sign) {
-						value = -value - 1;
-					}
-
-					decode_next[j] += value;
+					decode_next[j] += buffer.read_delta(bit_width[j]);
 				}
 
 				next_time = double(base_frame) * frame_to_sec + page_base_time;
@@ -5643,14 +5643,7 @@ bool Animation::_fetch_compressed_by_index(uint32_t p_compressed_track, int p_in
 							if (bit_width[l] == 0) {
 								continue; // do none
 							}
-							uint32_t valueu = buffer.read(bit_width[l] + 1);
-							bool sign = valueu & (1 << bit_width[l]);
-							int16_t value = valueu & ((1 << bit_width[l]) - 1);
-							if (sign) {
-								value = -value - 1;
-							}
-
-							decode[l] += value;
+							decode[l] += buffer.read_delta(bit_width[l]);
 						}
 					}
 				}
@@ -124,6 +124,60 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_build_instantiate_plan() const {
+	int nc = nodes.size();
+	int sname_count = names.size();
+	int prop_count = variants.size();
+
+	instantiate_plan.property_offsets.resize(nc + 1);
+	instantiate_plan.properties.clear();
+	instantiate_plan.child_counts.resize(nc);
+	for (int i = 0; i < nc; i++) {
+		instantiate_plan.child_counts[i] = 0;
+	}
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		instantiate_plan.property_offsets[i] = instantiate_plan.properties.size();
+
+		if (i > 0 && n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < i) {
+			instantiate_plan.child_counts[n.parent]++;
+		}
+
+		// Setters can only be resolved ahead of time for native nodes created by this scene, other nodes
+		// (instances, inherited or extension classes) may handle any property dynamically.
+		bool resolve_setters = !(i == 0 && base_scene_idx >= 0) && n.instance < 0 && n.type != TYPE_INSTANTIATED && n.type >= 0 && n.type < sname_count;
+		StringName type;
+		if (resolve_setters) {
+			type = names[n.type];
+			ClassDB::APIType api = ClassDB::get_api_type(type);
+			resolve_setters = api == ClassDB::API_CORE || api == ClassDB::API_EDITOR;
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			InstantiatePlan::Property planned;
+
+			if (resolve_setters && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name >= 0 && prop.name < sname_count && prop.value >= 0 && prop.value < prop_count) {
+				const StringName &pname = names[prop.name];
+				// Objects, arrays and dictionaries may need to be made local or duplicated, keep them on the generic path.
+				Variant::Type value_type = variants[prop.value].get_type();
+				if (pname != CoreStringName(script) && value_type != Variant::OBJECT && value_type != Variant::ARRAY && value_type != Variant::DICTIONARY) {
+					bool valid = false;
+					int index = ClassDB::get_property_index(type, pname, &valid);
+					StringName setter = valid ? ClassDB::get_property_setter(type, pname) : StringName();
+					if (setter != StringName()) {
+						planned.setter = ClassDB::get_method(type, setter);
+						planned.index = index;
+					}
+				}
+			}
+
+			instantiate_plan.properties.push_back(planned);
+		}
+	}
+	instantiate_plan.property_offsets[nc] = instantiate_plan.properties.size();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -141,6 +195,14 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	int nc = nodes.size();
 	ERR_FAIL_COND_V_MSG(nc == 0, nullptr, vformat("Failed to instantiate scene state of \"%s\", node count is 0. Make sure the PackedScene resource is valid.", path));
 
+	if (!instantiate_plan_built.is_set()) {
+		MutexLock lock(instantiate_plan_mutex);
+		if (!instantiate_plan_built.is_set()) {
+			_build_instantiate_plan();
+			instantiate_plan_built.set();
+		}
+	}
+
 	const StringName *snames = nullptr;
 	int sname_count = names.size();
 	if (sname_count) {
@@ -191,6 +253,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		const InstantiatePlan::Property *planned_props = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -261,7 +324,16 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 			node = Object::cast_to<Node>(obj);
 
-			if (!node) {
+			if (node) {
+				// Setters resolved by the plan are only valid at runtime, the editor must go through `Object::set()` to track edits.
+				// Nodes without properties may start past the last entry, so the offset isn't used to index.
+				if (p_edit_state == GEN_EDIT_STATE_DISABLED && n.properties.size() > 0) {
+					planned_props = instantiate_plan.properties.ptr() + instantiate_plan.property_offsets[i];
+				}
+				if (instantiate_plan.child_counts[i] > 0) {
+					node->data.children.reserve(instantiate_plan.child_counts[i]);
+				}
+			} else {
 				if (obj) {
 					memdelete(obj);
 					obj = nullptr;
@@ -313,6 +385,20 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
 
+					if (planned_props && planned_props[j].setter && !node->get_script_instance()) {
+						// Call the resolved setter directly, skipping the name based lookups of `Object::set()`.
+						Callable::CallError ce;
+						if (planned_props[j].index >= 0) {
+							Variant index = planned_props[j].index;
+							const Variant *args[2] = { &index, &props[nprops[j].value] };
+							planned_props[j].setter->call(node, args, 2, ce);
+						} else {
+							const Variant *args[1] = { &props[nprops[j].value] };
+							planned_props[j].setter->call(node, args, 1, ce);
+						}
+						continue;
+					}
+
 					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
 						if (!Engine::get_singleton()->is_editor_hint() && node->get_scene_instance_load_placeholder()) {
 							// We cannot know if the referenced nodes exist yet, so instead of deferring, we write the NodePaths directly.
@@ -1334,6 +1420,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	instantiate_plan_built.clear();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1525,6 +1612,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	instantiate_plan_built.clear();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -2029,6 +2118,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	instantiate_plan_built.clear();
 
 	return nodes.size() - 1;
 }
@@ -2045,6 +2135,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	instantiate_plan_built.clear();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -2232,6 +2323,23 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_multiple(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *node = instantiate(p_edit_state);
+		if (!node) {
+			ret.resize(i);
+			break;
+		}
+		ret[i] = node;
+	}
+
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2318,6 +2426,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_multiple", "count", "edit_state"), &PackedScene::instantiate_multiple, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -88,6 +88,24 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Work that only depends on the scene data, resolved once and reused by every instantiation.
+	struct InstantiatePlan {
+		struct Property {
+			MethodBind *setter = nullptr; // Null when the property must go through `Object::set()`.
+			int index = -1;
+		};
+
+		LocalVector<uint32_t> property_offsets; // Start of each node's entries in `properties`.
+		LocalVector<Property> properties;
+		LocalVector<uint32_t> child_counts;
+	};
+
+	mutable InstantiatePlan instantiate_plan;
+	mutable SafeFlag instantiate_plan_built;
+	mutable Mutex instantiate_plan_mutex;
+
+	void _build_instantiate_plan() const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -257,6 +275,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_multiple(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -247,6 +247,21 @@ public:
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	GDVIRTUAL1RC(PackedByteArray, _space_create_snapshot, RID)
+	GDVIRTUAL2R(bool, _space_restore_snapshot, RID, const PackedByteArray &)
+
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override {
+		PackedByteArray ret;
+		GDVIRTUAL_CALL(_space_create_snapshot, p_space, ret);
+		return ret;
+	}
+
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override {
+		bool ret = false;
+		GDVIRTUAL_CALL(_space_restore_snapshot, p_space, p_snapshot, ret);
+		return ret;
+	}
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
@@ -669,6 +669,16 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+void PhysicsServer3D::body_test_motion_batch(MotionBatchItem *p_items, int p_item_count) {
+	ERR_FAIL_COND(p_item_count < 0);
+	ERR_FAIL_COND(p_item_count > 0 && p_items == nullptr);
+
+	for (int i = 0; i < p_item_count; i++) {
+		MotionBatchItem &item = p_items[i];
+		item.collided = body_test_motion(item.body, item.parameters, &item.result);
+	}
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -723,6 +733,8 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_create_snapshot", "space"), &PhysicsServer3D::space_create_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer3D::space_restore_snapshot);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -313,6 +313,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	virtual PackedByteArray space_create_snapshot(RID p_space) const = 0;
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -574,6 +577,19 @@ public:
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) = 0;
 
+	struct MotionBatchItem {
+		RID body;
+		MotionParameters parameters;
+		MotionResult result;
+		bool collided = false;
+	};
+
+	// Tests the motion of many bodies in one call. Items are resolved against the
+	// space as it was before the call, then servers may resolve overlapping items
+	// against each other in array order, so results never depend on threading.
+	// Like body_test_motion(), it must be called from the main thread.
+	virtual void body_test_motion_batch(MotionBatchItem *p_items, int p_item_count);
+
 	/* SOFT BODY */
 
 	virtual RID soft_body_create() = 0;
@@ -172,6 +172,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override { return Vector<Vector3>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
 
+	virtual PackedByteArray space_create_snapshot(RID p_space) const override { return PackedByteArray(); }
+	virtual bool space_restore_snapshot(RID p_space, const PackedByteArray &p_snapshot) override { return false; }
+
 	/* AREA API */
 
 	virtual RID area_create() override { return RID(); }
@@ -133,6 +133,9 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(PackedByteArray, space_create_snapshot, RID);
+	FUNC2R(bool, space_restore_snapshot, RID, const PackedByteArray &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -274,6 +277,11 @@ public:
 		return physics_server_3d->body_test_motion(p_body, p_parameters, r_result);
 	}
 
+	void body_test_motion_batch(MotionBatchItem *p_items, int p_item_count) override {
+		ERR_FAIL_COND(!Thread::is_main_thread());
+		physics_server_3d->body_test_motion_batch(p_items, p_item_count);
+	}
+
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override {
 		ERR_FAIL_COND_V(!Thread::is_main_thread(), nullptr);
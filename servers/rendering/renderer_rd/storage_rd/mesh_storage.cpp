@@ -2469,6 +2469,20 @@ Transform2D MeshStorage::skeleton_bone_get_transform_2d(RID p_skeleton, int p_bo
 	return t;
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * (skeleton->use_2d ? 8 : 12));
+	if (p_buffer.is_empty()) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
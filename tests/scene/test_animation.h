@@ -308,4 +308,39 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Compressed tracks sample like the original tracks") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Enemy:position"));
+	const int blend_shape_track = animation->add_track(Animation::TYPE_BLEND_SHAPE);
+	animation->track_set_path(blend_shape_track, NodePath("Enemy:smile"));
+	for (int i = 0; i <= 240; i++) {
+		const double time = i / 60.0;
+		animation->position_track_insert_key(position_track, time, Vector3(Math::sin(time), time, Math::cos(time) * 2.0));
+		animation->blend_shape_track_insert_key(blend_shape_track, time, Math::sin(time * 3.0));
+	}
+
+	Ref<Animation> compressed = animation->duplicate();
+	// A small page size spreads the keys over many pages.
+	compressed->compress(512);
+	CHECK(compressed->track_is_compressed(position_track));
+	CHECK(compressed->track_is_compressed(blend_shape_track));
+
+	for (int i = 0; i <= 400; i++) {
+		const double time = i / 100.0;
+		Vector3 expected_position;
+		Vector3 position;
+		CHECK(animation->try_position_track_interpolate(position_track, time, &expected_position) == OK);
+		CHECK(compressed->try_position_track_interpolate(position_track, time, &position) == OK);
+		CHECK(position.distance_to(expected_position) < 0.01);
+
+		float expected_blend = 0.0;
+		float blend = 0.0;
+		CHECK(animation->try_blend_shape_track_interpolate(blend_shape_track, time, &expected_blend) == OK);
+		CHECK(compressed->try_blend_shape_track_interpolate(blend_shape_track, time, &blend) == OK);
+		CHECK(Math::abs(blend - expected_blend) < 0.01);
+	}
+}
+
 } // namespace TestAnimation
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "scene/animation/animation_blend_tree.h"
+#include "scene/animation/animation_node_state_machine.h"
+#include "scene/main/window.h"
 
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
@@ -81,4 +83,81 @@ TEST_CASE("[SceneTree][AnimationBlendTree] Create AnimationBlendTree and add Ani
 	CHECK_EQ(connections[0], StringName());
 }
 
+TEST_CASE("[SceneTree][AnimationBlendTree] AnimationTrees sharing a blend tree keep their own parameters") {
+	Ref<AnimationNodeBlendTree> blend_tree;
+	blend_tree.instantiate();
+	Ref<AnimationNodeBlend2> blend;
+	blend.instantiate();
+	blend_tree->add_node("blend", blend);
+	blend_tree->connect_node("output", 0, "blend");
+	Ref<AnimationNodeStateMachine> state_machine;
+	state_machine.instantiate();
+	blend_tree->add_node("state_machine", state_machine);
+
+	AnimationTree *tree_a = memnew(AnimationTree);
+	AnimationTree *tree_b = memnew(AnimationTree);
+	tree_a->set_root_animation_node(blend_tree);
+	tree_b->set_root_animation_node(blend_tree);
+
+	tree_a->set("parameters/blend/blend_amount", 0.5);
+	CHECK(double(tree_a->get("parameters/blend/blend_amount")) == doctest::Approx(0.5));
+	CHECK(double(tree_b->get("parameters/blend/blend_amount")) == doctest::Approx(0.0));
+
+	// Object parameters are created for each AnimationTree.
+	Object *playback_a = tree_a->get("parameters/state_machine/playback");
+	Object *playback_b = tree_b->get("parameters/state_machine/playback");
+	CHECK(playback_a != nullptr);
+	CHECK(playback_b != nullptr);
+	CHECK(playback_a != playback_b);
+
+	// Renaming a node moves the values of every AnimationTree.
+	blend_tree->rename_node("blend", "mix");
+	CHECK(double(tree_a->get("parameters/mix/blend_amount")) == doctest::Approx(0.5));
+	CHECK(double(tree_b->get("parameters/mix/blend_amount")) == doctest::Approx(0.0));
+
+	List<PropertyInfo> property_list;
+	tree_b->get_property_list(&property_list);
+	bool has_renamed_property = false;
+	for (const PropertyInfo &property : property_list) {
+		has_renamed_property = has_renamed_property || property.name == "parameters/mix/blend_amount";
+		CHECK(property.name != "parameters/blend/blend_amount");
+	}
+	CHECK(has_renamed_property);
+
+	memdelete(tree_a);
+	memdelete(tree_b);
+}
+
+TEST_CASE("[SceneTree][AnimationBlendTree] AnimationTrees sharing a blend tree keep their own node paths") {
+	Ref<AnimationNodeBlendTree> blend_tree;
+	blend_tree.instantiate();
+	Ref<AnimationNodeBlend2> blend;
+	blend.instantiate();
+	blend_tree->add_node("blend", blend);
+	blend_tree->connect_node("output", 0, "blend");
+
+	AnimationTree *tree_a = memnew(AnimationTree);
+	AnimationTree *tree_b = memnew(AnimationTree);
+	tree_a->set_root_animation_node(blend_tree);
+	tree_b->set_root_animation_node(blend_tree);
+	SceneTree::get_singleton()->get_root()->add_child(tree_a);
+	SceneTree::get_singleton()->get_root()->add_child(tree_b);
+
+	// The inputs of the blend node are not connected, so the process is aborted after the paths are set.
+	ERR_PRINT_OFF;
+	tree_a->advance(0.1);
+	CHECK(blend->get_node_state_base_path() == StringName("parameters/blend/"));
+
+	// A rename rebuilds the shared layout, so neither AnimationTree may keep using the previous path.
+	blend_tree->rename_node("blend", "mix");
+	tree_b->advance(0.1);
+	CHECK(blend->get_node_state_base_path() == StringName("parameters/mix/"));
+	tree_a->advance(0.1);
+	CHECK(blend->get_node_state_base_path() == StringName("parameters/mix/"));
+	ERR_PRINT_ON;
+
+	memdelete(tree_a);
+	memdelete(tree_b);
+}
+
 } //namespace TestAnimationBlendTree
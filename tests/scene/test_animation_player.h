@@ -0,0 +1,306 @@
+/**************************************************************************/
+/*  test_animation_player.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationPlayer {
+
+// Builds a character whose AnimationPlayer moves its "Target" child, and adds it to the tree.
+static AnimationPlayer *add_character(Node3D **r_character, Node3D **r_target) {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track, NodePath("Target"));
+	animation->position_track_insert_key(track, 0.0, Vector3());
+	animation->position_track_insert_key(track, 1.0, Vector3(10, 20, 30));
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Node3D *character = memnew(Node3D);
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	character->add_child(target);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	character->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+
+	*r_character = character;
+	*r_target = target;
+	return player;
+}
+
+// Plays the animation on several characters and returns where each of them ended up.
+static LocalVector<Vector3> play_crowd(int p_count, bool p_parallel) {
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/parallel_blending", p_parallel);
+
+	LocalVector<Node3D *> characters;
+	LocalVector<Node3D *> targets;
+	for (int i = 0; i < p_count; i++) {
+		Node3D *character = nullptr;
+		Node3D *target = nullptr;
+		AnimationPlayer *player = add_character(&character, &target);
+		player->play("move");
+		characters.push_back(character);
+		targets.push_back(target);
+	}
+
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->process(0.25);
+
+	LocalVector<Vector3> positions;
+	for (int i = 0; i < p_count; i++) {
+		positions.push_back(targets[i]->get_position());
+		memdelete(characters[i]);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/parallel_blending", false);
+	return positions;
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Parallel blending matches serial blending") {
+	const int count = 16;
+	LocalVector<Vector3> serial = play_crowd(count, false);
+	LocalVector<Vector3> parallel = play_crowd(count, true);
+
+	REQUIRE_EQ(serial.size(), (uint32_t)count);
+	REQUIRE_EQ(parallel.size(), (uint32_t)count);
+	CHECK_FALSE(serial[0].is_zero_approx());
+	for (int i = 0; i < count; i++) {
+		CHECK(serial[i].is_equal_approx(parallel[i]));
+	}
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Root motion track changes are picked up by existing caches") {
+	Node3D *character = nullptr;
+	Node3D *target = nullptr;
+	AnimationPlayer *player = add_character(&character, &target);
+
+	player->play("move");
+	SceneTree::get_singleton()->process(0.25);
+	const Vector3 position = target->get_position();
+	CHECK(position.is_equal_approx(Vector3(2.5, 5, 7.5)));
+
+	// The track is now extracted as root motion instead of moving the node.
+	player->set_root_motion_track(NodePath("Target"));
+	SceneTree::get_singleton()->process(0.25);
+	CHECK(target->get_position().is_equal_approx(position));
+	CHECK(player->get_root_motion_position().is_equal_approx(Vector3(2.5, 5, 7.5)));
+
+	player->set_root_motion_track(NodePath());
+	SceneTree::get_singleton()->process(0.25);
+	CHECK(target->get_position().is_equal_approx(Vector3(7.5, 15, 22.5)));
+	CHECK(player->get_root_motion_position().is_zero_approx());
+
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Bone rotations at full weight match blending from the rest") {
+	const Quaternion rest_rotation = Quaternion(Vector3(0, 1, 0), 0.5);
+	// Opposite sign of the shortest rotation from the rest.
+	const Quaternion rotation = -Quaternion(Vector3(1, 0, 0), 2.5);
+
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	int track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(track, NodePath("Skeleton3D:Bone"));
+	animation->rotation_track_insert_key(track, 0.0, rotation);
+	animation->rotation_track_insert_key(track, 1.0, rotation);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("pose", animation);
+
+	Node3D *character = memnew(Node3D);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton3D");
+	skeleton->add_bone("Bone");
+	skeleton->set_bone_rest(0, Transform3D(Basis(rest_rotation)));
+	skeleton->reset_bone_poses();
+	character->add_child(skeleton);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	character->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+
+	player->play("pose");
+	SceneTree::get_singleton()->process(0.25);
+
+	// What blending from the rest with a weight of one gives, including the sign of the result.
+	const Quaternion expected = (rest_rotation * Quaternion().slerp(rest_rotation.inverse() * rotation, 1.0)).normalized();
+	CHECK(skeleton->get_bone_pose_rotation(0).is_equal_approx(expected));
+
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Updates skipped by level of detail are caught up") {
+	Node3D *reference = nullptr;
+	Node3D *reference_target = nullptr;
+	AnimationPlayer *reference_player = add_character(&reference, &reference_target);
+
+	Node3D *character = nullptr;
+	Node3D *target = nullptr;
+	AnimationPlayer *player = add_character(&character, &target);
+
+	// Not seen by any camera, so it is off-screen.
+	VisibleOnScreenNotifier3D *notifier = memnew(VisibleOnScreenNotifier3D);
+	notifier->set_name("Notifier");
+	character->add_child(notifier);
+	player->set_lod_visibility_notifier(NodePath("../Notifier"));
+
+	reference_player->play("move");
+	player->play("move");
+
+	uint64_t skipped = AnimationMixer::get_lod_skipped_update_count();
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->process(0.25);
+	CHECK_EQ(AnimationMixer::get_lod_skipped_update_count(), skipped + 2);
+	CHECK(target->get_position().is_zero_approx());
+	CHECK_FALSE(reference_target->get_position().is_zero_approx());
+
+	// The skipped time is applied with the next update.
+	player->set_lod_visibility_notifier(NodePath());
+	SceneTree::get_singleton()->process(0.25);
+	CHECK(target->get_position().is_equal_approx(reference_target->get_position()));
+
+	memdelete(reference);
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Updates skipped by level of detail distance are caught up") {
+	Camera3D *camera = memnew(Camera3D);
+	SceneTree::get_singleton()->get_root()->add_child(camera);
+	camera->make_current();
+
+	Node3D *reference = nullptr;
+	Node3D *reference_target = nullptr;
+	AnimationPlayer *reference_player = add_character(&reference, &reference_target);
+
+	// Far enough from the camera to skip the maximum number of frames.
+	Node3D *character = nullptr;
+	Node3D *target = nullptr;
+	AnimationPlayer *player = add_character(&character, &target);
+	character->set_position(Vector3(100, 0, 0));
+	player->set_lod_distance(10.0);
+	player->set_lod_max_skipped_frames(2);
+
+	reference_player->play("move");
+	player->play("move");
+
+	uint64_t skipped = AnimationMixer::get_lod_skipped_update_count();
+	SceneTree::get_singleton()->process(0.1);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK_EQ(AnimationMixer::get_lod_skipped_update_count(), skipped + 2);
+	CHECK(target->get_position().is_zero_approx());
+	CHECK_FALSE(reference_target->get_position().is_zero_approx());
+
+	SceneTree::get_singleton()->process(0.1);
+	CHECK_EQ(AnimationMixer::get_lod_skipped_update_count(), skipped + 2);
+	CHECK(target->get_position().is_equal_approx(reference_target->get_position()));
+
+	// Close to the camera, nothing is skipped.
+	character->set_position(Vector3());
+	SceneTree::get_singleton()->process(0.1);
+	CHECK_EQ(AnimationMixer::get_lod_skipped_update_count(), skipped + 2);
+	CHECK(target->get_position().is_equal_approx(reference_target->get_position()));
+
+	memdelete(reference);
+	memdelete(character);
+	memdelete(camera);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Root motion is applied once when updates are skipped by level of detail") {
+	Camera3D *camera = memnew(Camera3D);
+	SceneTree::get_singleton()->get_root()->add_child(camera);
+	camera->make_current();
+
+	Node3D *character = nullptr;
+	Node3D *target = nullptr;
+	AnimationPlayer *player = add_character(&character, &target);
+	player->set_root_motion_track(NodePath("Target"));
+	character->set_position(Vector3(100, 0, 0));
+	player->set_lod_distance(10.0);
+	player->set_lod_max_skipped_frames(2);
+	player->play("move");
+
+	// Two skipped frames, one update and another skipped frame, like a script applying the root motion every frame.
+	Vector3 applied_motion;
+	for (int i = 0; i < 4; i++) {
+		SceneTree::get_singleton()->process(0.25);
+		applied_motion += player->get_root_motion_position();
+	}
+	CHECK(player->get_root_motion_position().is_zero_approx());
+	CHECK(applied_motion.is_equal_approx(Vector3(7.5, 15, 22.5)));
+
+	memdelete(character);
+	memdelete(camera);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Time skipped by level of detail is capped") {
+	Node3D *character = nullptr;
+	Node3D *target = nullptr;
+	AnimationPlayer *player = add_character(&character, &target);
+	player->get_animation("move")->set_loop_mode(Animation::LOOP_LINEAR);
+
+	VisibleOnScreenNotifier3D *notifier = memnew(VisibleOnScreenNotifier3D);
+	notifier->set_name("Notifier");
+	character->add_child(notifier);
+	player->set_lod_visibility_notifier(NodePath("../Notifier"));
+	player->play("move");
+
+	// Off-screen for longer than the animation.
+	for (int i = 0; i < 4; i++) {
+		SceneTree::get_singleton()->process(0.4);
+	}
+	CHECK(target->get_position().is_zero_approx());
+
+	// Only the length of the animation is caught up, so playback resumes at 1.0 + 0.2 instead of 1.6 + 0.2.
+	player->set_lod_visibility_notifier(NodePath());
+	SceneTree::get_singleton()->process(0.2);
+	CHECK(target->get_position().is_equal_approx(Vector3(2, 4, 6)));
+
+	memdelete(character);
+}
+
+} // namespace TestAnimationPlayer
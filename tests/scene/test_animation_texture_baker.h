@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  test_animation_texture_baker.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "scene/3d/animation_texture_baker.h"
+#include "scene/3d/node_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+
+namespace TestAnimationTextureBaker {
+
+TEST_CASE("[SceneTree][AnimationTextureBaker] Baked textures match CPU skinning") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton3D");
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+	const int root = skeleton->add_bone("root");
+	const int child = skeleton->add_bone("child");
+	skeleton->set_bone_parent(child, root);
+	skeleton->set_bone_rest(child, Transform3D(Basis(), Vector3(0, 1, 0)));
+	skeleton->reset_bone_poses();
+	Ref<Skin> skin = skeleton->create_skin_from_rest_transforms();
+
+	Ref<Animation> animation = memnew(Animation);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Skeleton3D:root"));
+	animation->position_track_insert_key(position_track, 0.0, Vector3());
+	animation->position_track_insert_key(position_track, 1.0, Vector3(2, 0, 0));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Skeleton3D:child"));
+	animation->rotation_track_insert_key(rotation_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(rotation_track, 1.0, Quaternion(Vector3(0, 0, 1), Math::PI / 2));
+
+	const Vector<Vector3> vertices = { Vector3(0, 0.5, 0), Vector3(0, 1.5, 0), Vector3(0.5, 1, 0) };
+	const Vector<int> bones = { root, 0, 0, 0, child, 0, 0, 0, root, child, 0, 0 };
+	const Vector<float> weights = { 1, 0, 0, 0, 1, 0, 0, 0, 0.5, 0.5, 0, 0 };
+	const Vector<Vector3> normals = { Vector3(0, 0, 1), Vector3(1, 0, 0), Vector3(0, 1, 0) };
+	const Vector<float> tangents = { 1, 0, 0, 1, 0, 0, -1, -1, 1, 0, 0, 1 };
+	Array arrays;
+	arrays.resize(Mesh::ARRAY_MAX);
+	arrays[Mesh::ARRAY_VERTEX] = vertices;
+	arrays[Mesh::ARRAY_NORMAL] = normals;
+	arrays[Mesh::ARRAY_TANGENT] = tangents;
+	arrays[Mesh::ARRAY_BONES] = bones;
+	arrays[Mesh::ARRAY_WEIGHTS] = weights;
+	Ref<ArrayMesh> mesh = memnew(ArrayMesh);
+	mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+
+	Ref<AnimationTextureBaker> baker = memnew(AnimationTextureBaker);
+	baker->set_fps(10.0);
+	CHECK(baker->get_frame_count(animation) == 11);
+
+	Ref<Image> bone_texture = baker->bake_bone_texture(skeleton, skin, animation);
+	REQUIRE(bone_texture.is_valid());
+	CHECK(bone_texture->get_width() == 2 * AnimationTextureBaker::BONE_TEXELS);
+	CHECK(bone_texture->get_height() == 11);
+
+	Ref<Image> vertex_texture = baker->bake_vertex_texture(mesh, 0, bone_texture);
+	REQUIRE(vertex_texture.is_valid());
+	CHECK(vertex_texture->get_width() == 3);
+	CHECK(vertex_texture->get_height() == 11);
+
+	Ref<Image> normal_texture = baker->bake_vertex_texture(mesh, 0, bone_texture, AnimationTextureBaker::VERTEX_DATA_NORMAL);
+	REQUIRE(normal_texture.is_valid());
+	CHECK(normal_texture->get_format() == Image::FORMAT_RGBF);
+	Ref<Image> tangent_texture = baker->bake_vertex_texture(mesh, 0, bone_texture, AnimationTextureBaker::VERTEX_DATA_TANGENT);
+	REQUIRE(tangent_texture.is_valid());
+	CHECK(tangent_texture->get_format() == Image::FORMAT_RGBAF);
+
+	for (int frame = 0; frame < 11; frame++) {
+		const double time = frame / 10.0;
+		skeleton->set_bone_pose_position(root, animation->position_track_interpolate(position_track, time));
+		skeleton->set_bone_pose_rotation(child, animation->rotation_track_interpolate(rotation_track, time));
+
+		Transform3D skinning[2];
+		for (int bind = 0; bind < 2; bind++) {
+			skinning[bind] = skeleton->get_bone_global_pose(skin->get_bind_bone(bind)) * skin->get_bind_pose(bind);
+			CHECK(AnimationTextureBaker::get_bone_texture_transform(bone_texture, frame, bind).is_equal_approx(skinning[bind]));
+		}
+
+		for (int vertex = 0; vertex < vertices.size(); vertex++) {
+			Vector3 expected;
+			Vector3 expected_normal;
+			Vector3 expected_tangent;
+			for (int i = 0; i < 4; i++) {
+				const Transform3D &bone_skinning = skinning[bones[vertex * 4 + i]];
+				const float weight = weights[vertex * 4 + i];
+				expected += bone_skinning.xform(vertices[vertex]) * weight;
+				expected_normal += bone_skinning.basis.xform(normals[vertex]) * weight;
+				expected_tangent += bone_skinning.basis.xform(Vector3(tangents[vertex * 4 + 0], tangents[vertex * 4 + 1], tangents[vertex * 4 + 2])) * weight;
+			}
+			const Color baked = vertex_texture->get_pixel(vertex, frame);
+			CHECK(Vector3(baked.r, baked.g, baked.b).distance_to(expected) < 0.001);
+			const Color baked_normal = normal_texture->get_pixel(vertex, frame);
+			CHECK(Vector3(baked_normal.r, baked_normal.g, baked_normal.b).distance_to(expected_normal.normalized()) < 0.001);
+			const Color baked_tangent = tangent_texture->get_pixel(vertex, frame);
+			CHECK(Vector3(baked_tangent.r, baked_tangent.g, baked_tangent.b).distance_to(expected_tangent.normalized()) < 0.001);
+			CHECK(baked_tangent.a == tangents[vertex * 4 + 3]);
+		}
+	}
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[AnimationTextureBaker] Vertex playback shader") {
+	Ref<Shader> shader = AnimationTextureBaker::create_vertex_playback_shader();
+	REQUIRE(shader.is_valid());
+	CHECK(shader->get_mode() == Shader::MODE_SPATIAL);
+	CHECK(shader->get_code().contains("uniform sampler2D vertex_positions"));
+	CHECK(shader->get_code().contains("uniform sampler2D vertex_normals"));
+}
+
+TEST_CASE("[SceneTree][AnimationTextureBaker] Only tracks of the baked skeleton are baked") {
+	Node3D *character = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+	Node3D *body = memnew(Node3D);
+	body->set_name("Body");
+	character->add_child(body);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton3D");
+	body->add_child(skeleton);
+	skeleton->add_bone("root");
+	Skeleton3D *other_skeleton = memnew(Skeleton3D);
+	other_skeleton->set_name("OtherSkeleton");
+	body->add_child(other_skeleton);
+	other_skeleton->add_bone("root");
+
+	Ref<Animation> animation = memnew(Animation);
+	const int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track, NodePath("Body/Skeleton3D:root"));
+	animation->position_track_insert_key(track, 0.0, Vector3(2, 0, 0));
+	const int other_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(other_track, NodePath("Body/OtherSkeleton:root"));
+	animation->position_track_insert_key(other_track, 0.0, Vector3(0, 5, 0));
+
+	Ref<AnimationTextureBaker> baker = memnew(AnimationTextureBaker);
+
+	// Relative to the parent of the skeleton, neither track points to it.
+	Ref<Image> bone_texture = baker->bake_bone_texture(skeleton, Ref<Skin>(), animation);
+	REQUIRE(bone_texture.is_valid());
+	CHECK(AnimationTextureBaker::get_bone_texture_transform(bone_texture, 0, 0).origin.is_zero_approx());
+
+	bone_texture = baker->bake_bone_texture(skeleton, Ref<Skin>(), animation, character);
+	REQUIRE(bone_texture.is_valid());
+	CHECK(AnimationTextureBaker::get_bone_texture_transform(bone_texture, 0, 0).origin.is_equal_approx(Vector3(2, 0, 0)));
+
+	memdelete(character);
+}
+
+} // namespace TestAnimationTextureBaker
@@ -32,6 +32,7 @@
 
 #include "scene/resources/3d/height_map_shape_3d.h"
 #include "scene/resources/image_texture.h"
+#include "servers/physics_server_3d.h"
 
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
@@ -116,4 +117,43 @@ TEST_CASE("[SceneTree][HeightMapShape3D] update_map_data_from_image") {
 	CHECK(height_map_shape->get_max_height() == 10.0);
 }
 
+TEST_CASE("[SceneTree][HeightMapShape3D] update_map_data_region") {
+	Ref<HeightMapShape3D> height_map_shape = memnew(HeightMapShape3D);
+	height_map_shape->set_map_width(3);
+	height_map_shape->set_map_depth(3);
+	height_map_shape->set_map_data(Vector<real_t>{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 });
+
+	// Update the bottom right 2x2 region, extending the height range.
+	height_map_shape->update_map_data_region(Rect2i(1, 1, 2, 2), Vector<real_t>{ -1.0, 20.0, 3.0, 4.0 });
+	Vector<real_t> expected_map_data = { 0.0, 1.0, 2.0, 3.0, -1.0, 20.0, 6.0, 3.0, 4.0 };
+	CHECK(height_map_shape->get_map_data() == expected_map_data);
+	CHECK(height_map_shape->get_min_height() == -1.0);
+	CHECK(height_map_shape->get_max_height() == 20.0);
+
+	// Overwrite both extremes, the range shrinks to the rest of the map.
+	height_map_shape->update_map_data_region(Rect2i(1, 1, 2, 1), Vector<real_t>{ 5.0, 1.0 });
+	expected_map_data = { 0.0, 1.0, 2.0, 3.0, 5.0, 1.0, 6.0, 3.0, 4.0 };
+	CHECK(height_map_shape->get_map_data() == expected_map_data);
+	CHECK(height_map_shape->get_min_height() == 0.0);
+	CHECK(height_map_shape->get_max_height() == 6.0);
+
+	// The physics server patched its copy of the heights.
+	const Variant server_data = PhysicsServer3D::get_singleton()->shape_get_data(height_map_shape->get_rid());
+	if (server_data.get_type() == Variant::DICTIONARY) {
+		const Dictionary d = server_data;
+		const PackedFloat32Array server_heights = d["heights"];
+		REQUIRE(server_heights.size() == expected_map_data.size());
+		for (int i = 0; i < expected_map_data.size(); i++) {
+			CHECK(server_heights[i] == expected_map_data[i]);
+		}
+	}
+
+	// Regions outside of the map and data of the wrong size are rejected.
+	ERR_PRINT_OFF;
+	height_map_shape->update_map_data_region(Rect2i(2, 2, 2, 2), Vector<real_t>{ 9.0, 9.0, 9.0, 9.0 });
+	height_map_shape->update_map_data_region(Rect2i(0, 0, 2, 2), Vector<real_t>{ 9.0 });
+	ERR_PRINT_ON;
+	CHECK(height_map_shape->get_map_data() == expected_map_data);
+}
+
 } // namespace TestHeightMapShape3D
@@ -47,6 +47,9 @@ protected:
 			case NOTIFICATION_INTERNAL_PROCESS: {
 				internal_process_counter++;
 				push_self();
+				if (toggle_physics_process_on_internal_process) {
+					set_physics_process(!is_physics_processing());
+				}
 			} break;
 			case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 				internal_physics_process_counter++;
@@ -55,6 +58,13 @@ protected:
 			case NOTIFICATION_PROCESS: {
 				process_counter++;
 				push_self();
+				if (accessed_node) {
+					accessed_node->set_editor_description("Accessed");
+				}
+				if (changed_node) {
+					changed_node->set_process_internal(true);
+					changed_node->set_process_priority(changed_node->get_process_priority() + 1);
+				}
 			} break;
 			case NOTIFICATION_PHYSICS_PROCESS: {
 				physics_process_counter++;
@@ -90,6 +100,9 @@ public:
 	Array exported_nodes;
 
 	List<Node *> *callback_list = nullptr;
+	Node *accessed_node = nullptr; // Modified while processing.
+	Node *changed_node = nullptr; // Processing flags and priority changed while processing.
+	bool toggle_physics_process_on_internal_process = false;
 
 	void set_exported_node(Node *p_node) { exported_node = p_node; }
 	Node *get_exported_node() const { return exported_node; }
@@ -436,6 +449,41 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E->get(), node1_1);
 	}
 
+	SUBCASE("Groups should keep tree order after removals and allow removals while iterating") {
+		SceneTree *tree = SceneTree::get_singleton();
+		node2->add_to_group("nodes");
+		node1_1->add_to_group("nodes");
+		node1->add_to_group("nodes");
+		CHECK_EQ(tree->get_first_node_in_group("nodes"), node1);
+
+		// Swap-removing the first node must not leak the last node to the front.
+		node1->remove_from_group("nodes");
+		List<Node *> nodes;
+		tree->get_nodes_in_group("nodes", &nodes);
+		CHECK_EQ(nodes.size(), 2);
+		CHECK_EQ(nodes.front()->get(), node1_1);
+		CHECK_EQ(nodes.back()->get(), node2);
+
+		LocalVector<Node *> visited;
+		tree->for_each_node_in_group("nodes", [&](Node *p_node) {
+			visited.push_back(p_node);
+			node2->remove_from_group("nodes");
+			return true;
+		});
+		CHECK_EQ(visited.size(), 1);
+		CHECK_EQ(visited[0], node1_1);
+		CHECK_EQ(tree->get_node_count_in_group("nodes"), 1);
+
+		visited.clear();
+		tree->for_each_node_in_group("nodes", [&](Node *p_node) {
+			visited.push_back(p_node);
+			p_node->remove_from_group("nodes");
+			return true;
+		});
+		CHECK_EQ(visited.size(), 1);
+		CHECK_FALSE(tree->has_group("nodes"));
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
@@ -910,10 +958,120 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 		CHECK_EQ(E->get(), node3);
 	}
 
+	SUBCASE("Process priority after disabling and enabling processing") {
+		node->set_process(true);
+		node->set_process_priority(20);
+		node2->set_process(true);
+		node2->set_process_priority(10);
+		node3->set_process(true);
+		node3->set_process_priority(40);
+		node4->set_process(true);
+		node4->set_process_priority(30);
+
+		SceneTree::get_singleton()->process(0);
+		process_order.clear();
+
+		node2->set_process(false);
+		node4->set_process_internal(true);
+		SceneTree::get_singleton()->process(0);
+
+		// node4 is notified twice, for internal and normal processing.
+		CHECK_EQ(4, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), node);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node3);
+		CHECK_EQ(1, node4->internal_process_counter);
+		CHECK_EQ(1, node2->process_counter);
+	}
+
+	SUBCASE("Nodes changing their processing later in the same frame") {
+		node->set_process(true);
+		node->set_process_priority(10);
+		node2->set_process(true);
+		node2->set_process_priority(20);
+		node3->set_process(true);
+		node3->set_process_priority(30);
+		node4->set_process(true);
+		node4->set_process_internal(true);
+		node4->set_process_priority(40);
+
+		SceneTree::get_singleton()->process(0);
+		process_order.clear();
+
+		// Before their turn, node2 starts internal processing and its priority changes.
+		node->changed_node = node2;
+		// node4 toggles physics processing from its own internal processing.
+		node4->toggle_physics_process_on_internal_process = true;
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(6, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), node);
+		E = E->next();
+		CHECK_EQ(E->get(), node2);
+		E = E->next();
+		CHECK_EQ(E->get(), node2);
+		E = E->next();
+		CHECK_EQ(E->get(), node3);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		CHECK_EQ(1, node2->internal_process_counter);
+		CHECK_EQ(2, node4->process_counter);
+		CHECK(node4->is_physics_processing());
+
+		node->changed_node = nullptr;
+		node4->toggle_physics_process_on_internal_process = false;
+	}
+
 	memdelete(node);
 	memdelete(node2);
 	memdelete(node3);
 	memdelete(node4);
 }
 
+#ifdef DEBUG_ENABLED
+TEST_CASE("[SceneTree][Node] Process thread groups accessing each other are detected") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	TestNode *node = memnew(TestNode);
+	node->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	tree->get_root()->add_child(node);
+
+	TestNode *node2 = memnew(TestNode);
+	node2->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	tree->get_root()->add_child(node2);
+
+	node->accessed_node = node2;
+	node->set_process(true);
+	node2->set_process(true);
+
+	// While debugging, the access is recorded instead of rejected by the thread guard.
+	tree->set_debug_process_thread_groups(true);
+	ERR_PRINT_OFF;
+	tree->process(0);
+	ERR_PRINT_ON;
+	CHECK_EQ(node2->get_editor_description(), "Accessed");
+	CHECK_EQ(1, node->process_counter);
+	CHECK_EQ(1, node2->process_counter);
+
+	// Once debugging is disabled, the conflicting groups are processed on the main thread, where the access is valid.
+	tree->set_debug_process_thread_groups(false);
+	node2->set_editor_description("");
+	tree->process(0);
+	CHECK_EQ(node2->get_editor_description(), "Accessed");
+	CHECK_EQ(2, node->process_counter);
+	CHECK_EQ(2, node2->process_counter);
+
+	memdelete(node);
+	memdelete(node2);
+}
+#endif // DEBUG_ENABLED
+
 } // namespace TestNode
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -215,6 +217,131 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Multiple Packed Scenes") {
+	// Create a scene to pack, with properties set through resolved setters.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+	scene->set_editor_description("Root");
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_physics_process_priority(-2);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate the packed scene several times.
+	TypedArray<Node> instances = packed_scene.instantiate_multiple(3);
+	CHECK(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_process_priority() == 3);
+		CHECK(instance->get_editor_description() == "Root");
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_name() == "Child");
+		CHECK(instance->get_child(0)->get_physics_process_priority() == -2);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		memdelete(instance);
+	}
+
+	CHECK(packed_scene.instantiate_multiple(0).is_empty());
+
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instantiate Packed Scene Whose Last Node Has No Properties") {
+	// Create a scene to pack, where only the root has saved properties.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+	REQUIRE(packed_scene.get_state()->get_node_property_count(1) == 0);
+
+	// Instantiate the packed scene.
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_process_priority() == 3);
+	CHECK(instance->get_child_count() == 1);
+	CHECK(instance->get_child(0)->get_name() == "Child");
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
+static TypedArray<Node> async_committed_nodes;
+
+static void _store_async_committed_nodes(const TypedArray<Node> &p_nodes) {
+	async_committed_nodes = p_nodes;
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate Packed Scene Asynchronously") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *parent = memnew(Node);
+	tree->get_root()->add_child(parent);
+
+	// With no budget, a single node is added to the tree per frame.
+	int old_budget = tree->get_async_instantiation_budget_usec();
+	tree->set_async_instantiation_budget_usec(0);
+
+	async_committed_nodes.clear();
+	tree->instantiate_async(packed_scene, parent, 3, callable_mp_static(&_store_async_committed_nodes));
+	CHECK(tree->get_pending_async_instantiation_count() == 1);
+
+	int previous_count = 0;
+	for (int i = 0; i < 10000 && tree->get_pending_async_instantiation_count() > 0; i++) {
+		tree->process(0);
+		CHECK(parent->get_child_count() - previous_count <= 1);
+		previous_count = parent->get_child_count();
+		OS::get_singleton()->delay_usec(100);
+	}
+
+	CHECK(tree->get_pending_async_instantiation_count() == 0);
+	CHECK(parent->get_child_count() == 3);
+	CHECK(async_committed_nodes.size() == 3);
+	for (int i = 0; i < parent->get_child_count(); i++) {
+		Node *instance = parent->get_child(i);
+		CHECK(async_committed_nodes.has(instance));
+		CHECK(instance->is_inside_tree());
+		CHECK(instance->is_ready());
+		CHECK(instance->get_process_priority() == 5);
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+	}
+
+	tree->set_async_instantiation_budget_usec(old_budget);
+	async_committed_nodes.clear();
+	memdelete(parent);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
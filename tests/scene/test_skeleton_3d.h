@@ -33,6 +33,7 @@
 #include "tests/test_macros.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
 
 namespace TestSkeleton3D {
 
@@ -72,4 +73,30 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[SceneTree][Skeleton3D] Global poses of skeletons with several root bones") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+	for (int i = 0; i < 2; i++) {
+		int root = skeleton->add_bone(vformat("root%d", i));
+		skeleton->set_bone_rest(root, Transform3D(Basis(), Vector3(i + 1, 0, 0)));
+		int child = skeleton->add_bone(vformat("child%d", i));
+		skeleton->set_bone_parent(child, root);
+		skeleton->set_bone_rest(child, Transform3D(Basis(), Vector3(0, 1, 0)));
+	}
+	skeleton->reset_bone_poses();
+	skeleton->force_update_all_bone_transforms();
+
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 1, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(2, 1, 0)));
+	CHECK(skeleton->get_bone_global_rest(3).origin.is_equal_approx(Vector3(2, 1, 0)));
+
+	// Moving the second root moves its child too.
+	skeleton->set_bone_pose_position(2, Vector3(5, 0, 0));
+	skeleton->force_update_all_dirty_bones();
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 1, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(5, 1, 0)));
+
+	memdelete(skeleton);
+}
 } // namespace TestSkeleton3D
@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTween {
+
+TEST_CASE("[SceneTree][Tween] Many tweens processed by the SceneTree") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const int count = 100;
+
+	Vector<Node2D *> nodes;
+	Vector<Ref<Tween>> tweens;
+	for (int i = 0; i < count; i++) {
+		Node2D *node = memnew(Node2D);
+		tree->get_root()->add_child(node);
+		nodes.push_back(node);
+
+		Ref<Tween> tween = tree->create_tween();
+		tween->tween_property(node, NodePath("position"), Vector2(i, i), 1.0);
+		tween->parallel()->tween_property(node, NodePath("modulate"), Color(0, 0, 0), 1.0);
+		tweens.push_back(tween);
+	}
+	CHECK(tree->get_processed_tweens().size() == count);
+
+	tree->process(0.5);
+	for (int i = 0; i < count; i++) {
+		CHECK(nodes[i]->get_position().is_equal_approx(Vector2(i, i) * 0.5));
+		CHECK(nodes[i]->get_modulate().is_equal_approx(Color(0.5, 0.5, 0.5)));
+	}
+
+	// Killed tweens stop being processed, the others keep going.
+	tweens[0]->kill();
+	tweens[count - 1]->kill();
+	tree->process(0.25);
+	CHECK(tree->get_processed_tweens().size() == count - 2);
+	CHECK(nodes[count - 1]->get_position().is_equal_approx(Vector2(count - 1, count - 1) * 0.5));
+	CHECK(nodes[1]->get_position().is_equal_approx(Vector2(0.75, 0.75)));
+
+	// Finished tweens are removed on the next frame.
+	tree->process(0.5);
+	tree->process(0.0);
+	CHECK(tree->get_processed_tweens().is_empty());
+	for (int i = 1; i < count - 1; i++) {
+		CHECK(nodes[i]->get_position().is_equal_approx(Vector2(i, i)));
+		CHECK_FALSE(tweens[i]->is_valid());
+	}
+
+	for (Node2D *node : nodes) {
+		memdelete(node);
+	}
+}
+
+} // namespace TestTween
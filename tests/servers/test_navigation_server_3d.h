@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
+#include "modules/navigation_3d/3d/nav_mesh_generator_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -416,6 +418,73 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->free(map);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should make agents avoid each other with the uniform grid neighbor search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// The neighbor search is chosen when the map is created. The second map uses the KD tree for reference.
+		ProjectSettings::get_singleton()->set_setting("navigation/avoidance/neighbor_search/use_uniform_grid", true);
+		RID grid_map = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/avoidance/neighbor_search/use_uniform_grid", false);
+		RID tree_map = navigation_server->map_create();
+
+		const RID maps[2] = { grid_map, tree_map };
+		LocalVector<RID> agents[2];
+		LocalVector<CallableMock *> agent_avoidance_callback_mocks[2];
+		for (int m = 0; m < 2; m++) {
+			navigation_server->map_set_active(maps[m], true);
+
+			// A row of agents walking towards a row of agents coming the other way, far more than one grid cell apart.
+			// The last agent is alone, further than its neighbor distance from any other agent.
+			for (int i = 0; i < 9; i++) {
+				for (int side = 0; side < (i < 8 ? 2 : 1); side++) {
+					RID agent = navigation_server->agent_create();
+					navigation_server->agent_set_map(agent, maps[m]);
+					navigation_server->agent_set_avoidance_enabled(agent, true);
+					navigation_server->agent_set_neighbor_distance(agent, 5);
+					navigation_server->agent_set_position(agent, Vector3(side * 2.5, 0, i * 20 + side * 0.5));
+					navigation_server->agent_set_radius(agent, 1);
+					navigation_server->agent_set_velocity(agent, Vector3(side == 0 ? 1 : -1, 0, 0));
+					CallableMock *agent_avoidance_callback_mock = memnew(CallableMock);
+					navigation_server->agent_set_avoidance_callback(agent, callable_mp(agent_avoidance_callback_mock, &CallableMock::function1));
+					agents[m].push_back(agent);
+					agent_avoidance_callback_mocks[m].push_back(agent_avoidance_callback_mock);
+				}
+			}
+		}
+
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const LocalVector<CallableMock *> &mocks = agent_avoidance_callback_mocks[0];
+		for (uint32_t i = 0; i + 1 < agents[0].size(); i += 2) {
+			REQUIRE_EQ(mocks[i]->function1_calls, 1);
+			REQUIRE_EQ(mocks[i + 1]->function1_calls, 1);
+			Vector3 agent_1_safe_velocity = mocks[i]->function1_latest_arg0;
+			Vector3 agent_2_safe_velocity = mocks[i + 1]->function1_latest_arg0;
+			CHECK_MESSAGE(agent_1_safe_velocity.x > 0, "agent 1 should move a bit along desired velocity (+X)");
+			CHECK_MESSAGE(agent_2_safe_velocity.x < 0, "agent 2 should move a bit along desired velocity (-X)");
+			CHECK_MESSAGE(agent_1_safe_velocity.z < 0, "agent 1 should move a bit to the side so that it avoids agent 2");
+			CHECK_MESSAGE(agent_2_safe_velocity.z > 0, "agent 2 should move a bit to the side so that it avoids agent 1");
+		}
+		REQUIRE_EQ(mocks[mocks.size() - 1]->function1_calls, 1);
+		Vector3 lone_agent_safe_velocity = mocks[mocks.size() - 1]->function1_latest_arg0;
+		CHECK_MESSAGE(lone_agent_safe_velocity.is_equal_approx(Vector3(1, 0, 0)), "agent without neighbors should keep its desired velocity");
+
+		// Both searches find the same neighbors.
+		for (uint32_t i = 0; i < agents[0].size(); i++) {
+			REQUIRE_EQ(agent_avoidance_callback_mocks[1][i]->function1_calls, 1);
+			Vector3 grid_safe_velocity = agent_avoidance_callback_mocks[0][i]->function1_latest_arg0;
+			Vector3 tree_safe_velocity = agent_avoidance_callback_mocks[1][i]->function1_latest_arg0;
+			CHECK(grid_safe_velocity.is_equal_approx(tree_safe_velocity));
+		}
+
+		for (int m = 0; m < 2; m++) {
+			for (uint32_t i = 0; i < agents[m].size(); i++) {
+				navigation_server->free(agents[m][i]);
+				memdelete(agent_avoidance_callback_mocks[m][i]);
+			}
+			navigation_server->free(maps[m]);
+		}
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should make agents avoid dynamic obstacles when avoidance enabled") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
 
@@ -803,6 +872,359 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake navigation mesh tiles and rebake changed tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(32.0, 0.001, 32.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+		CHECK_GT(NavMeshGenerator3D::get_last_rebaked_tile_count(navigation_mesh), 1u);
+		const int polygon_count = navigation_mesh->get_polygon_count();
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Paths should cross the seams between tiles") {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-14, 0, -14), Vector3(14, 0, 14), true);
+			REQUIRE_NE(path.size(), 0);
+			const Vector3 path_end = path[path.size() - 1];
+			CHECK_LT(Vector2(path_end.x, path_end.z).distance_to(Vector2(14, 14)), 0.1);
+		}
+
+		SUBCASE("Unchanged tiles should be restored after the navigation mesh was cleared") {
+			navigation_mesh->clear();
+			navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_last_rebaked_tile_count(navigation_mesh), 0u);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+
+			// Baking without tiles replaces the data too.
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_last_rebaked_tile_count(navigation_mesh), 0u);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+		}
+
+		SUBCASE("Changed source geometry should rebake the affected tiles") {
+			Vector<Vector3> obstruction_vertices;
+			obstruction_vertices.push_back(Vector3(3, 0, 3));
+			obstruction_vertices.push_back(Vector3(5, 0, 3));
+			obstruction_vertices.push_back(Vector3(5, 0, 5));
+			obstruction_vertices.push_back(Vector3(3, 0, 5));
+			source_geometry->add_projected_obstruction(obstruction_vertices, -1.0, 2.0, true);
+			navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+			// The obstruction and its border fit in a single tile.
+			CHECK_EQ(NavMeshGenerator3D::get_last_rebaked_tile_count(navigation_mesh), 1u);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Vector3 closest_point = navigation_server->map_get_closest_point(map, Vector3(4, 0, 4));
+			CHECK_GE(Vector2(closest_point.x, closest_point.z).distance_to(Vector2(4, 4)), 0.9);
+
+			source_geometry->clear_projected_obstructions();
+			navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_last_rebaked_tile_count(navigation_mesh), 1u);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			closest_point = navigation_server->map_get_closest_point(map, Vector3(4, 0, 4));
+			CHECK_LT(Vector2(closest_point.x, closest_point.z).distance_to(Vector2(4, 4)), 0.1);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should keep stacked floors apart when stitching tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		// Two floors above each other that both cross the seams at x = 0 and z = 0.
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(16.0, 0.001, 16.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		source_geometry->add_mesh_array(arr, Transform3D(Basis(), Vector3(0, 4, 0)));
+		navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 8.0, Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		// No polygon is welded or split across both floors.
+		const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+		int upper_polygon_count = 0;
+		for (int i = 0; i < navigation_mesh->get_polygon_count(); i++) {
+			const Vector<int> polygon = navigation_mesh->get_polygon(i);
+			real_t min_y = vertices[polygon[0]].y;
+			real_t max_y = min_y;
+			for (int index : polygon) {
+				min_y = MIN(min_y, vertices[index].y);
+				max_y = MAX(max_y, vertices[index].y);
+			}
+			CHECK_LT(max_y - min_y, 1.0);
+			if (min_y > 2.0) {
+				upper_polygon_count++;
+			}
+		}
+		CHECK_GT(upper_polygon_count, 0);
+		CHECK_LT(upper_polygon_count, navigation_mesh->get_polygon_count());
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// Both floors connect across the seams on their own.
+		for (real_t floor_y : { (real_t)0.0, (real_t)4.0 }) {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-6, floor_y, -6), Vector3(6, floor_y, 6), true);
+			REQUIRE_NE(path.size(), 0);
+			for (const Vector3 &path_point : path) {
+				CHECK_LT(Math::abs(path_point.y - floor_y), 1.0);
+			}
+			const Vector3 path_end = path[path.size() - 1];
+			CHECK_LT(Vector2(path_end.x, path_end.z).distance_to(Vector2(6, 6)), 0.1);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should find paths with hierarchical pathfinding") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		navigation_mesh->set_vertices({ Vector3(0, 0, 0), Vector3(4, 0, 0), Vector3(4, 0, 4), Vector3(0, 0, 4) });
+		navigation_mesh->add_polygon({ 0, 1, 2, 3 });
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		// A 5x5 grid of regions with a wall in the middle column that forces a detour through the last row.
+		LocalVector<RID> regions;
+		RID detour_region;
+		for (int z = 0; z < 5; z++) {
+			for (int x = 0; x < 5; x++) {
+				if (x == 2 && z < 4) {
+					continue;
+				}
+				RID region = navigation_server->region_create();
+				navigation_server->region_set_use_async_iterations(region, false);
+				navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * 4, 0, z * 4)));
+				navigation_server->region_set_map(region, map);
+				navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+				regions.push_back(region);
+				if (x == 2) {
+					detour_region = region;
+				}
+			}
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 start_position = Vector3(2, 0, 2);
+		const Vector3 target_position = Vector3(18, 0, 2);
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(start_position);
+		query_parameters->set_target_position(target_position);
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+
+		CHECK_FALSE(navigation_server->map_get_use_hierarchical_pathfinding(map));
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> path = query_result->get_path();
+		const float path_length = query_result->get_path_length();
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(target_position));
+		CHECK_GT(path_length, start_position.distance_to(target_position));
+
+		navigation_server->map_set_use_hierarchical_pathfinding(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK(navigation_server->map_get_use_hierarchical_pathfinding(map));
+
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> hierarchical_path = query_result->get_path();
+		REQUIRE_NE(hierarchical_path.size(), 0);
+		CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+		CHECK_LE(query_result->get_path_length(), path_length * 1.1f);
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should reconnect only changed regions of a map") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		navigation_mesh->set_vertices({ Vector3(0, 0, 0), Vector3(4, 0, 0), Vector3(4, 0, 4), Vector3(0, 0, 4) });
+		navigation_mesh->add_polygon({ 0, 1, 2, 3 });
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		// A row of regions where the first three share their edges and the last one is connected by the edge connection margin.
+		LocalVector<RID> regions;
+		for (int x = 0; x < 4; x++) {
+			RID region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * 4 + (x == 3 ? 0.1 : 0.0), 0, 0)));
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			regions.push_back(region);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 start_position = Vector3(2, 0, 2);
+		const Vector3 target_position = Vector3(14, 0, 2);
+
+		Vector<Vector3> path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(target_position));
+
+		navigation_server->region_set_map(regions[1], RID());
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK_LE(path[path.size() - 1].x, 4.0);
+
+		navigation_server->region_set_map(regions[1], map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(target_position));
+
+		navigation_server->region_set_transform(regions[3], Transform3D(Basis(), Vector3(12.05, 0, 0)));
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(target_position));
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should reuse cached routes of path queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		navigation_mesh->set_vertices({ Vector3(0, 0, 0), Vector3(4, 0, 0), Vector3(4, 0, 4), Vector3(0, 0, 4) });
+		navigation_mesh->add_polygon({ 0, 1, 2, 3 });
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		// A 5x5 grid of regions with a wall in the middle column that forces a detour through the last row.
+		LocalVector<RID> regions;
+		RID detour_region;
+		for (int z = 0; z < 5; z++) {
+			for (int x = 0; x < 5; x++) {
+				if (x == 2 && z < 4) {
+					continue;
+				}
+				RID region = navigation_server->region_create();
+				navigation_server->region_set_use_async_iterations(region, false);
+				navigation_server->region_set_transform(region, Transform3D(Basis(), Vector3(x * 4, 0, z * 4)));
+				navigation_server->region_set_map(region, map);
+				navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+				regions.push_back(region);
+				if (x == 2) {
+					detour_region = region;
+				}
+			}
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// Many agents on the left side going to the same target on the right side.
+		const Vector3 target_position = Vector3(18, 0, 2);
+		LocalVector<Vector3> start_positions;
+		for (int z = 0; z < 4; z++) {
+			for (int x = 0; x < 2; x++) {
+				start_positions.push_back(Vector3(x * 4 + 1, 0, z * 4 + 1));
+				start_positions.push_back(Vector3(x * 4 + 3, 0, z * 4 + 3));
+			}
+		}
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		query_parameters->set_target_position(target_position);
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+
+		LocalVector<float> path_lengths;
+		for (const Vector3 &start_position : start_positions) {
+			query_parameters->set_start_position(start_position);
+			navigation_server->query_path(query_parameters, query_result);
+			path_lengths.push_back(query_result->get_path_length());
+		}
+
+		CHECK_FALSE(navigation_server->map_get_use_path_cache(map));
+		navigation_server->map_set_use_path_cache(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK(navigation_server->map_get_use_path_cache(map));
+
+		// The first pass fills the cache, the second one only follows cached routes.
+		for (int pass = 0; pass < 2; pass++) {
+			for (uint32_t i = 0; i < start_positions.size(); i++) {
+				query_parameters->set_start_position(start_positions[i]);
+				navigation_server->query_path(query_parameters, query_result);
+				const Vector<Vector3> path = query_result->get_path();
+				REQUIRE_NE(path.size(), 0);
+				CHECK(path[0].is_equal_approx(start_positions[i]));
+				CHECK(path[path.size() - 1].is_equal_approx(target_position));
+				CHECK_LE(query_result->get_path_length(), path_lengths[i] * 1.1f);
+			}
+		}
+
+		SUBCASE("Queries that filter regions should not use cached routes") {
+			// Every cached route crosses the only region of the middle column.
+			query_parameters->set_start_position(start_positions[0]);
+			query_parameters->set_excluded_regions({ detour_region });
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> path = query_result->get_path();
+			CHECK_FALSE((!path.is_empty() && path[path.size() - 1].is_equal_approx(target_position)));
+
+			query_parameters->set_excluded_regions(TypedArray<RID>());
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> cached_path = query_result->get_path();
+			REQUIRE_NE(cached_path.size(), 0);
+			CHECK(cached_path[cached_path.size() - 1].is_equal_approx(target_position));
+		}
+
+		for (const RID &region : regions) {
+			navigation_server->free(region);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -0,0 +1,298 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+TEST_CASE("[PhysicsServer3D] Space snapshot restores body state") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	if (!space.is_valid()) {
+		// The dummy server has no spaces to snapshot.
+		return;
+	}
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	const int body_count = 8;
+	LocalVector<RID> bodies;
+	for (int i = 0; i < body_count; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+		physics_server->body_add_shape(body, shape);
+		physics_server->body_set_space(body, space);
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 2.0, 1.0, 0.0)));
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0.0, 0.0, i));
+		bodies.push_back(body);
+	}
+
+	const PackedByteArray snapshot = physics_server->space_create_snapshot(space);
+	CHECK_FALSE(snapshot.is_empty());
+
+	for (const RID &body : bodies) {
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(100.0, 100.0, 100.0)));
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(-1.0, -1.0, -1.0));
+	}
+
+	CHECK(physics_server->space_restore_snapshot(space, snapshot));
+	// Snapshots of the same state are byte for byte identical.
+	CHECK(physics_server->space_create_snapshot(space) == snapshot);
+
+	for (int i = 0; i < body_count; i++) {
+		const Transform3D transform = physics_server->body_get_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		const Vector3 linear_velocity = physics_server->body_get_state(bodies[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+		CHECK(transform.origin.is_equal_approx(Vector3(i * 2.0, 1.0, 0.0)));
+		CHECK(linear_velocity.is_equal_approx(Vector3(0.0, 0.0, i)));
+	}
+
+	SUBCASE("Invalid snapshots should be rejected") {
+		PackedByteArray corrupted = snapshot;
+		corrupted.resize(corrupted.size() / 2);
+
+		ERR_PRINT_OFF;
+		CHECK_FALSE(physics_server->space_restore_snapshot(space, corrupted));
+		CHECK_FALSE(physics_server->space_restore_snapshot(space, PackedByteArray()));
+		ERR_PRINT_ON;
+	}
+
+	for (const RID &body : bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+TEST_CASE("[PhysicsServer3D] Batched motion tests match single motion tests") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	if (!space.is_valid()) {
+		// The dummy server has no spaces to test motion in.
+		return;
+	}
+
+	RID floor_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector3(50.0, 0.5, 50.0));
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(floor, floor_shape);
+	physics_server->body_set_space(floor, space);
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	// Characters spread apart on a grid, falling onto the floor.
+	const int body_count = 16;
+	LocalVector<RID> bodies;
+	LocalVector<PhysicsServer3D::MotionBatchItem> items;
+	for (int i = 0; i < body_count; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_KINEMATIC);
+		physics_server->body_add_shape(body, shape);
+		physics_server->body_set_space(body, space);
+
+		const Transform3D transform(Basis(), Vector3((i % 4) * 4.0, 2.0, (i / 4) * 4.0));
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, transform);
+		bodies.push_back(body);
+
+		PhysicsServer3D::MotionBatchItem item;
+		item.body = body;
+		item.parameters = PhysicsServer3D::MotionParameters(transform, Vector3(1.0, -3.0, 0.5));
+		items.push_back(item);
+	}
+
+	physics_server->body_test_motion_batch(items.ptr(), items.size());
+
+	for (int i = 0; i < body_count; i++) {
+		PhysicsServer3D::MotionResult result;
+		const bool collided = physics_server->body_test_motion(bodies[i], items[i].parameters, &result);
+
+		CHECK(collided);
+		CHECK(items[i].collided == collided);
+		CHECK(items[i].result.travel.is_equal_approx(result.travel));
+		CHECK(items[i].result.collision_count == result.collision_count);
+		CHECK(items[i].result.travel.y < 0.0);
+		CHECK(items[i].result.travel.y > -3.0);
+	}
+
+	SUBCASE("Results should not depend on scheduling") {
+		// Two characters walking into the same spot from opposite sides.
+		items[0].parameters = PhysicsServer3D::MotionParameters(Transform3D(Basis(), Vector3(-2.0, 1.5, 0.0)), Vector3(2.0, 0.0, 0.0));
+		items[1].parameters = PhysicsServer3D::MotionParameters(Transform3D(Basis(), Vector3(2.0, 1.5, 0.0)), Vector3(-2.0, 0.0, 0.0));
+
+		physics_server->body_test_motion_batch(items.ptr(), items.size());
+		const Vector3 first_travel = items[0].result.travel;
+		const Vector3 second_travel = items[1].result.travel;
+
+		for (int attempt = 0; attempt < 4; attempt++) {
+			physics_server->body_test_motion_batch(items.ptr(), items.size());
+			CHECK(items[0].result.travel == first_travel);
+			CHECK(items[1].result.travel == second_travel);
+		}
+
+		// The first item in the batch is never affected by the ones after it.
+		CHECK(first_travel.is_equal_approx(Vector3(2.0, 0.0, 0.0)));
+	}
+
+	for (const RID &body : bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(floor);
+	physics_server->free(shape);
+	physics_server->free(floor_shape);
+	physics_server->free(space);
+}
+
+TEST_CASE("[PhysicsServer3D] Batched motion tests resolve bodies moving into each other") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	if (!space.is_valid()) {
+		// The dummy server has no spaces to test motion in.
+		return;
+	}
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	// Two characters walking towards each other. Neither reaches the other's starting
+	// position, so they only collide once the first one has been moved.
+	const Vector3 origins[2] = { Vector3(-3.0, 0.0, 0.0), Vector3(3.0, 0.0, 0.0) };
+	const Vector3 motions[2] = { Vector3(3.0, 0.0, 0.0), Vector3(-3.0, 0.0, 0.0) };
+
+	RID bodies[2];
+	PhysicsServer3D::MotionBatchItem items[2];
+	for (int i = 0; i < 2; i++) {
+		bodies[i] = physics_server->body_create();
+		physics_server->body_set_mode(bodies[i], PhysicsServer3D::BODY_MODE_KINEMATIC);
+		physics_server->body_add_shape(bodies[i], shape);
+		physics_server->body_set_space(bodies[i], space);
+
+		const Transform3D transform(Basis(), origins[i]);
+		physics_server->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, transform);
+
+		items[i].body = bodies[i];
+		items[i].parameters = PhysicsServer3D::MotionParameters(transform, motions[i]);
+	}
+
+	// Tested one at a time, both motions are free.
+	for (int i = 0; i < 2; i++) {
+		CHECK_FALSE(physics_server->body_test_motion(bodies[i], items[i].parameters));
+	}
+
+	physics_server->body_test_motion_batch(items, 2);
+
+	CHECK_FALSE(items[0].collided);
+	CHECK(items[0].result.travel.is_equal_approx(motions[0]));
+
+	// The second character stops against the first one at the end of its motion.
+	CHECK(items[1].collided);
+	CHECK(items[1].result.collision_count > 0);
+	CHECK(items[1].result.collisions[0].collider == bodies[0]);
+	CHECK(items[1].result.collisions[0].normal.is_equal_approx(Vector3(1.0, 0.0, 0.0)));
+	CHECK(items[1].result.travel.x == doctest::Approx(-2.0).epsilon(0.01));
+
+	for (int i = 0; i < 2; i++) {
+		physics_server->free(bodies[i]);
+	}
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+TEST_CASE("[PhysicsServer3D] Cached contact manifolds are validated") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	if (!space.is_valid()) {
+		// The dummy server has no spaces to step.
+		return;
+	}
+	physics_server->space_set_active(space, true);
+	// Large enough for every step below to reuse the previous manifold.
+	physics_server->space_set_param(space, PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS, 1.0);
+
+	RID floor_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector3(0.5, 0.5, 0.5));
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(floor, floor_shape);
+	physics_server->body_set_space(floor, space);
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.25, 0.25, 0.25));
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+	physics_server->body_add_shape(body, shape);
+	physics_server->body_set_space(body, space);
+	physics_server->body_set_max_contacts_reported(body, 8);
+	physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+	physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0.0, 0.75, 0.0)));
+
+	const real_t step = 1.0 / 60.0;
+
+	// Resting on the floor, the contacts survive from one step to the next.
+	for (int i = 0; i < 30; i++) {
+		physics_server->step(step);
+		CHECK(physics_server->body_get_direct_state(body)->get_contact_count() > 0);
+	}
+	const Transform3D resting_transform = physics_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(resting_transform.origin.y == doctest::Approx(0.75).epsilon(0.01));
+
+	SUBCASE("Contacts left behind should be dropped") {
+		// Moved past the edge of the floor, but by less than the recycle radius.
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0.8, resting_transform.origin.y, 0.0)));
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3());
+
+		physics_server->step(step);
+		CHECK(physics_server->body_get_direct_state(body)->get_contact_count() == 0);
+
+		for (int i = 0; i < 10; i++) {
+			physics_server->step(step);
+		}
+		// Nothing holds the box up anymore.
+		const Transform3D transform = physics_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(transform.origin.y < resting_transform.origin.y - 0.1);
+	}
+
+	physics_server->free(body);
+	physics_server->free(floor);
+	physics_server->free(shape);
+	physics_server->free(floor_shape);
+	physics_server->free(space);
+}
+
+} // namespace TestPhysicsServer3D
@@ -146,6 +146,7 @@
 #include "tests/scene/test_texture_progress_bar.h"
 #include "tests/scene/test_theme.h"
 #include "tests/scene/test_timer.h"
+#include "tests/scene/test_tween.h"
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
@@ -168,6 +169,8 @@
 
 #ifndef _3D_DISABLED
 #include "tests/core/math/test_triangle_mesh.h"
+#include "tests/scene/test_animation_player.h"
+#include "tests/scene/test_animation_texture_baker.h"
 #include "tests/scene/test_arraymesh.h"
 #include "tests/scene/test_camera_3d.h"
 #include "tests/scene/test_convert_transform_modifier_3d.h"
@@ -183,6 +186,7 @@
 #ifndef PHYSICS_3D_DISABLED
 #include "tests/scene/test_height_map_shape_3d.h"
 #include "tests/scene/test_physics_material.h"
+#include "tests/servers/test_physics_server_3d.h"
 #endif // PHYSICS_3D_DISABLED
 
 #ifdef MODULE_NAVIGATION_2D_ENABLED